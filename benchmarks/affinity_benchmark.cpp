@@ -0,0 +1,132 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+
+// Compares pinned and unpinned worker threads on chatty actor pairs: every pair bounces a ball back and
+// forth, so throughput is dominated by how often actor state and messages migrate between caches and nodes.
+// Usage: affinity-benchmark [threads] [pairs] [round_trips_per_pair]
+
+using namespace std::chrono_literals;
+
+namespace ox = oxherdcpp;
+
+using Clock = std::chrono::steady_clock;
+
+struct BallMessage final : ox::Message<BallMessage>
+{
+    explicit BallMessage(const std::size_t remaining) : remaining{remaining}
+    {
+    }
+    std::size_t remaining;
+};
+
+class PlayerActor final : public ox::Actor
+{
+  public:
+    PlayerActor(const ox::Executor &exec, const std::string &name, const ox::ActorId id,
+                std::atomic<std::size_t> &finished)
+        : Actor(exec, name, id), finished_{finished}
+    {
+    }
+
+    std::optional<ox::ActorRef> partner;
+
+  private:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        const auto ball{ox::Cast<BallMessage>(message)};
+        // Touch some state so migrating the actor has a cost
+        for (auto &value : state_)
+        {
+            value += ball->remaining;
+        }
+        if (ball->remaining == 0)
+        {
+            finished_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        partner->Tell(ox::MakeMessage<BallMessage>(ball->remaining - 1));
+    }
+
+    std::atomic<std::size_t> &finished_;
+    std::array<std::size_t, 256> state_{};
+};
+
+auto RunOnce(const std::size_t threads, const ox::SchedulerKind scheduler, const ox::WorkerPinning pinning,
+             const std::size_t pairs, const std::size_t round_trips) -> double
+{
+    const auto system{std::make_shared<ox::ActorSystem>(
+        "affinity-benchmark",
+        ox::ActorSystemConfig{.thread_count = threads, .scheduler = scheduler, .affinity = {.pinning = pinning}})};
+
+    std::atomic<std::size_t> finished{0};
+    std::vector<ox::Sptr<PlayerActor>> players;
+    for (std::size_t i{0}; i < pairs; ++i)
+    {
+        // Both players of a pair share a shard when the system is sharded
+        const ox::ActorOptions options{.placement = ox::ShardPlacement::Explicit, .shard = i};
+        players.push_back(system->CreateActor<PlayerActor>(options, "ping-" + std::to_string(i), finished));
+        players.push_back(system->CreateActor<PlayerActor>(options, "pong-" + std::to_string(i), finished));
+        auto &ping{players[players.size() - 2]};
+        auto &pong{players.back()};
+        ping->partner.emplace(pong, system);
+        pong->partner.emplace(ping, system);
+        ping->Receive(ox::MakeMessage<ox::GoStartActor>());
+        pong->Receive(ox::MakeMessage<ox::GoStartActor>());
+    }
+    std::this_thread::sleep_for(20ms);
+
+    const auto start{Clock::now()};
+    for (std::size_t i{0}; i < pairs; ++i)
+    {
+        players[i * 2]->Receive(ox::MakeMessage<BallMessage>(round_trips * 2));
+    }
+    while (finished.load(std::memory_order_relaxed) < pairs)
+    {
+        std::this_thread::sleep_for(100us);
+    }
+    const auto elapsed{std::chrono::duration<double>(Clock::now() - start).count()};
+    system->Stop();
+
+    return static_cast<double>(pairs * round_trips * 2) / elapsed;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t threads{argc > 1 ? std::stoul(argv[1]) : std::max(2u, std::thread::hardware_concurrency())};
+    const std::size_t pairs{argc > 2 ? std::stoul(argv[2]) : threads * 4};
+    const std::size_t round_trips{argc > 3 ? std::stoul(argv[3]) : 20'000};
+
+    std::cout << "threads=" << threads << " pairs=" << pairs << " round_trips=" << round_trips
+              << " numa_nodes=" << ox::GetNumaNodes().size() << "\n";
+    std::cout << std::setw(14) << "scheduler" << std::setw(16) << "pinning" << std::setw(16) << "msg/s" << "\n";
+
+    const std::pair<ox::SchedulerKind, const char *> schedulers[]{{ox::SchedulerKind::SharedQueue, "shared-queue"},
+                                                                  {ox::SchedulerKind::WorkStealing, "work-stealing"},
+                                                                  {ox::SchedulerKind::Sharded, "sharded"}};
+    const std::pair<ox::WorkerPinning, const char *> pinnings[]{{ox::WorkerPinning::None, "none"},
+                                                                {ox::WorkerPinning::PerNumaNode, "per-numa-node"},
+                                                                {ox::WorkerPinning::PerCpu, "per-cpu"}};
+    for (const auto &[scheduler, scheduler_name] : schedulers)
+    {
+        for (const auto &[pinning, pinning_name] : pinnings)
+        {
+            const auto rate{RunOnce(threads, scheduler, pinning, pairs, round_trips)};
+            std::cout << std::setw(14) << scheduler_name << std::setw(16) << pinning_name << std::setw(16)
+                      << std::fixed << std::setprecision(0) << rate << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+
+// Compares the producer-side cost of a Tell loop with TellBatch for a sweep of batch sizes. Messages are
+// allocated before the clock starts, so only the send path is timed: resolving the reference, pushing into
+// the mailbox and the scheduling decision. A batch pays each of those once instead of once per message.
+// Usage: batch-tell-benchmark [messages] [threads]
+
+using namespace std::chrono_literals;
+
+namespace ox = oxherdcpp;
+
+using Clock = std::chrono::steady_clock;
+
+struct IngestMessage final : ox::Message<IngestMessage>
+{
+};
+
+class SinkActor final : public ox::Actor
+{
+  public:
+    SinkActor(const ox::Executor &exec, const std::string &name, const ox::ActorId id,
+              std::atomic<std::size_t> &processed)
+        : Actor(exec, name, id), processed_{processed}
+    {
+    }
+
+  private:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+        processed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::size_t> &processed_;
+};
+
+struct RunResult
+{
+    double send_ns_per_message{};
+    double messages_per_second{};
+};
+
+// A batch size of zero stands for the Tell loop
+auto RunOnce(const std::size_t threads, const std::size_t messages, const std::size_t batch_size) -> RunResult
+{
+    const auto system{std::make_shared<ox::ActorSystem>("batch-tell-benchmark",
+                                                        ox::ActorSystemConfig{.thread_count = threads})};
+    std::atomic<std::size_t> processed{0};
+    const auto sink{system->CreateActor<SinkActor>("sink", processed)};
+    ox::ActorRef ref{sink, system};
+    ref.Tell(ox::MakeMessage<ox::GoStartActor>());
+    std::this_thread::sleep_for(20ms);
+
+    std::vector<ox::MPtr<ox::BaseMessage>> pending;
+    pending.reserve(messages);
+    for (std::size_t i{0}; i < messages; ++i)
+    {
+        pending.push_back(ox::MakeMessage<IngestMessage>());
+    }
+
+    const auto start{Clock::now()};
+    if (batch_size == 0)
+    {
+        for (auto &message : pending)
+        {
+            ref.Tell(std::move(message));
+        }
+    }
+    else
+    {
+        for (std::size_t offset{0}; offset < messages; offset += batch_size)
+        {
+            ref.TellBatch(std::span{pending}.subspan(offset, std::min(batch_size, messages - offset)));
+        }
+    }
+    const auto sent{Clock::now()};
+    while (processed.load(std::memory_order_relaxed) < messages)
+    {
+        std::this_thread::sleep_for(50us);
+    }
+    const auto elapsed{std::chrono::duration<double>(Clock::now() - start).count()};
+    system->Stop();
+
+    return RunResult{.send_ns_per_message = std::chrono::duration<double, std::nano>(sent - start).count() /
+                                            static_cast<double>(messages),
+                     .messages_per_second = static_cast<double>(messages) / elapsed};
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t messages{argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    const std::size_t threads{argc > 2 ? std::stoul(argv[2]) : 2};
+
+    std::cout << "threads=" << threads << " messages=" << messages << "\n";
+    std::cout << std::setw(12) << "batch" << std::setw(16) << "send ns/msg" << std::setw(16) << "msg/s" << "\n";
+
+    for (const std::size_t batch_size : {0, 1, 8, 64, 512})
+    {
+        const auto [send_ns, rate]{RunOnce(threads, messages, batch_size)};
+        std::cout << std::setw(12) << (batch_size == 0 ? std::string{"tell"} : std::to_string(batch_size))
+                  << std::setw(16) << std::fixed << std::setprecision(1) << send_ns << std::setw(16)
+                  << std::setprecision(0) << rate << "\n";
+    }
+    return 0;
+}
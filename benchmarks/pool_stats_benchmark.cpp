@@ -0,0 +1,74 @@
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <oxherdcpp/actor/message/message.h>
+
+// Message allocation throughput with every thread allocating and freeing messages of one shared type, the
+// case where pool counters on a shared cache line hurt most. Whether the counters are compiled in is fixed
+// by the build: configure once with ACTOR_POOL_STATS=ON and once with OFF and compare the two runs.
+// Usage: pool-stats-benchmark [threads] [operations per thread]
+
+namespace ox = oxherdcpp;
+
+using Clock = std::chrono::steady_clock;
+
+struct CountedMessage final : ox::Message<CountedMessage>
+{
+    std::size_t payload{0};
+};
+
+int main(int argc, char **argv)
+{
+    const std::size_t threads{argc > 1 ? std::stoul(argv[1]) : 32};
+    const std::size_t operations{argc > 2 ? std::stoul(argv[2]) : 2'000'000};
+    // Messages each thread keeps alive, so frees are not always of the block just allocated
+    constexpr std::size_t kLiveMessages{16};
+
+    std::atomic<std::size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (std::size_t t{0}; t < threads; ++t)
+    {
+        workers.emplace_back([&] {
+            std::vector<ox::MPtr<CountedMessage>> live(kLiveMessages);
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire))
+            {
+            }
+            for (std::size_t i{0}; i < operations; ++i)
+            {
+                live[i % kLiveMessages] = ox::MakeMessage<CountedMessage>();
+            }
+        });
+    }
+    while (ready.load() < threads)
+    {
+        std::this_thread::yield();
+    }
+
+    const auto start{Clock::now()};
+    go.store(true, std::memory_order_release);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    const auto elapsed{std::chrono::duration<double>(Clock::now() - start).count()};
+
+    const auto total{static_cast<double>(threads * operations)};
+    std::cout << "pool stats " << (ox::kPoolStatsEnabled ? "on" : "off") << ", threads=" << threads
+              << " operations/thread=" << operations << "\n";
+    std::cout << std::fixed << std::setprecision(1) << "alloc+free per second: " << total / elapsed / 1e6
+              << " M\nns per alloc+free per thread: " << elapsed * 1e9 / static_cast<double>(operations) << "\n";
+    if constexpr (ox::kPoolStatsEnabled)
+    {
+        std::cout << "counted allocations: " << ox::GetMessagePoolStats<CountedMessage>().allocations.load()
+                  << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <oxherdcpp/actor/message/message.h>
+
+// Cost of taking and dropping extra references to a message, the pattern of a message stashed, wrapped in a
+// failure event or captured by a callback, for a shared message and for a thread confined one.
+// Usage: refcount-benchmark [operations]
+
+namespace ox = oxherdcpp;
+
+using Clock = std::chrono::steady_clock;
+
+struct SharedMessage final : ox::Message<SharedMessage>
+{
+};
+
+struct ConfinedMessage final : ox::Message<ConfinedMessage>
+{
+    static constexpr bool kThreadConfined{true};
+};
+
+template <typename MessageType> auto Measure(const std::size_t operations) -> double
+{
+    const auto message{ox::MakeMessage<MessageType>()};
+    std::vector<ox::MPtr<ox::BaseMessage>> references(8);
+    const auto start{Clock::now()};
+    for (std::size_t i{0}; i < operations; ++i)
+    {
+        // Copy assignment takes the new reference and drops the old one
+        references[i % references.size()] = message;
+    }
+    const auto elapsed{std::chrono::duration<double, std::nano>(Clock::now() - start).count()};
+    return elapsed / static_cast<double>(operations);
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t operations{argc > 1 ? std::stoul(argv[1]) : 100'000'000};
+
+    std::cout << "operations=" << operations << "\n";
+    std::cout << std::fixed << std::setprecision(2)
+              << "shared   ns per add_ref+release: " << Measure<SharedMessage>(operations)
+              << "\nconfined ns per add_ref+release: " << Measure<ConfinedMessage>(operations) << "\n";
+    return 0;
+}
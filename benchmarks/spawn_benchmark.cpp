@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/common/memory.h>
+
+// Measures what creating an actor costs before it handles anything: wall time, heap allocations and heap
+// bytes per actor, counted by replacing the global operator new of this program. The actors are only
+// constructed, so no scheduler or actor system is involved.
+// Usage: spawn-benchmark [actors]
+
+namespace ox = oxherdcpp;
+
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+std::atomic<std::size_t> allocation_count{0};
+std::atomic<std::size_t> allocated_bytes{0};
+
+auto CountedAllocate(const std::size_t size, const std::size_t alignment) -> void *
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    const auto rounded{(std::max<std::size_t>(size, 1) + alignment - 1) / alignment * alignment};
+    if (void *ptr{std::aligned_alloc(alignment, rounded)})
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+} // namespace
+
+// Actors hold cache-line aligned members, so they come from the aligned overloads
+auto operator new(const std::size_t size) -> void *
+{
+    return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+auto operator new(const std::size_t size, const std::align_val_t alignment) -> void *
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+auto operator delete(void *ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void *ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void *ptr, std::align_val_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void *ptr, std::size_t, std::align_val_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+class IdleActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+  private:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+    }
+};
+
+int main(int argc, char **argv)
+{
+    const std::size_t actors{argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+
+    boost::asio::io_context io_context;
+    const ox::Executor executor{io_context.get_executor()};
+    std::vector<ox::Sptr<IdleActor>> spawned;
+    spawned.reserve(actors);
+    // The name fits the small string buffer, so it does not count as an allocation of the actor
+    const std::string name{"idle"};
+
+    const auto allocations_before{allocation_count.load()};
+    const auto bytes_before{allocated_bytes.load()};
+    const auto start{Clock::now()};
+    for (std::size_t i{0}; i < actors; ++i)
+    {
+        spawned.push_back(ox::MakeSptr<IdleActor>(executor, name, ox::ActorIDGenerator::Generate()));
+    }
+    const auto elapsed{Clock::now() - start};
+    const auto allocations{allocation_count.load() - allocations_before};
+    const auto bytes{allocated_bytes.load() - bytes_before};
+
+    const auto per_actor{[actors](const auto value) {
+        return static_cast<double>(value) / static_cast<double>(actors);
+    }};
+    std::cout << "actors=" << actors << " sizeof(Actor)=" << sizeof(ox::Actor) << "\n";
+    std::cout << std::fixed << std::setprecision(1)
+              << "spawn ns/actor:        " << per_actor(std::chrono::duration<double, std::nano>(elapsed).count())
+              << "\nallocations/actor:     " << per_actor(allocations)
+              << "\nheap bytes/actor:      " << per_actor(bytes) << "\n";
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+
+// Sweeps the per-turn throughput of a system flooded by "hot" actors and measures how long a
+// lightly loaded probe actor waits for its messages. Small values favour probe latency, large
+// values favour raw throughput of the hot actors.
+// Usage: throughput-benchmark [threads] [messages_per_producer] [shared-queue|work-stealing]
+
+using namespace std::chrono_literals;
+
+namespace ox = oxherdcpp;
+
+using Clock = std::chrono::steady_clock;
+
+struct WorkMessage final : ox::Message<WorkMessage>
+{
+};
+
+struct ProbeMessage final : ox::Message<ProbeMessage>
+{
+    explicit ProbeMessage(const Clock::time_point sent) : sent{sent}
+    {
+    }
+    Clock::time_point sent;
+};
+
+class HotActor final : public ox::Actor
+{
+  public:
+    HotActor(const ox::Executor &exec, const std::string &name, const ox::ActorId id,
+             std::atomic<std::size_t> &processed)
+        : Actor(exec, name, id), processed_{processed}
+    {
+    }
+
+  private:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+        // A few hundred nanoseconds of "work" per message
+        volatile int sink{0};
+        for (int i{0}; i < 100; ++i)
+        {
+            sink = sink + i;
+        }
+        processed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::size_t> &processed_;
+};
+
+class ProbeActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    std::vector<double> latencies_us;
+
+  private:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        if (const auto probe{ox::Cast<ProbeMessage>(message)})
+        {
+            latencies_us.push_back(std::chrono::duration<double, std::micro>(Clock::now() - probe->sent).count());
+        }
+    }
+};
+
+struct RunResult
+{
+    double messages_per_second{};
+    double p50_us{};
+    double p99_us{};
+};
+
+auto Percentile(std::vector<double> values, const double percentile) -> double
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+    const auto index{static_cast<std::size_t>(percentile * static_cast<double>(values.size() - 1))};
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+auto RunOnce(const std::size_t threads, const ox::SchedulerKind scheduler, const std::size_t throughput,
+             const std::size_t messages_per_producer) -> RunResult
+{
+    const auto system{std::make_shared<ox::ActorSystem>(
+        "throughput-benchmark", ox::ActorSystemConfig{.thread_count = threads,
+                                                      .scheduler = scheduler,
+                                                      .default_actor_options = {.throughput = throughput}})};
+
+    std::atomic<std::size_t> processed{0};
+    std::vector<ox::Sptr<HotActor>> hot_actors;
+    std::vector<ox::ActorRef> hot;
+    for (std::size_t i{0}; i < threads * 2; ++i)
+    {
+        hot_actors.push_back(system->CreateActor<HotActor>("hot-" + std::to_string(i), processed));
+        hot.emplace_back(hot_actors.back(), system);
+        hot.back().Tell(ox::MakeMessage<ox::GoStartActor>());
+    }
+    const auto probe{system->CreateActor<ProbeActor>("probe")};
+    ox::ActorRef probe_ref{probe, system};
+    probe_ref.Tell(ox::MakeMessage<ox::GoStartActor>());
+    std::this_thread::sleep_for(50ms);
+
+    std::atomic<bool> done{false};
+    std::jthread prober{[&] {
+        while (!done.load(std::memory_order_acquire))
+        {
+            probe_ref.Tell(ox::MakeMessage<ProbeMessage>(Clock::now()));
+            std::this_thread::sleep_for(50us);
+        }
+    }};
+
+    const auto total{threads * messages_per_producer};
+    const auto start{Clock::now()};
+    {
+        std::vector<std::jthread> producers;
+        for (std::size_t p{0}; p < threads; ++p)
+        {
+            producers.emplace_back([&hot, p, messages_per_producer] {
+                for (std::size_t i{0}; i < messages_per_producer; ++i)
+                {
+                    hot[(p + i) % hot.size()].Tell(ox::MakeMessage<WorkMessage>());
+                }
+            });
+        }
+    }
+    while (processed.load(std::memory_order_relaxed) < total)
+    {
+        std::this_thread::sleep_for(100us);
+    }
+    const auto elapsed{std::chrono::duration<double>(Clock::now() - start).count()};
+
+    done.store(true, std::memory_order_release);
+    prober.join();
+    system->Stop();
+
+    return RunResult{.messages_per_second = static_cast<double>(total) / elapsed,
+                     .p50_us = Percentile(probe->latencies_us, 0.50),
+                     .p99_us = Percentile(probe->latencies_us, 0.99)};
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t threads{argc > 1 ? std::stoul(argv[1]) : std::max(2u, std::thread::hardware_concurrency())};
+    const std::size_t messages_per_producer{argc > 2 ? std::stoul(argv[2]) : 200'000};
+    const bool work_stealing{argc > 3 && std::string{argv[3]} == "work-stealing"};
+    const auto scheduler{work_stealing ? ox::SchedulerKind::WorkStealing : ox::SchedulerKind::SharedQueue};
+
+    std::cout << "threads=" << threads << " messages=" << threads * messages_per_producer
+              << " scheduler=" << (work_stealing ? "work-stealing" : "shared-queue") << "\n";
+    std::cout << std::setw(12) << "throughput" << std::setw(16) << "msg/s" << std::setw(14) << "probe p50 us"
+              << std::setw(14) << "probe p99 us" << "\n";
+
+    for (const std::size_t throughput : {1, 4, 16, 64, 256, 1024})
+    {
+        const auto [rate, p50, p99]{RunOnce(threads, scheduler, throughput, messages_per_producer)};
+        std::cout << std::setw(12) << throughput << std::setw(16) << std::fixed << std::setprecision(0) << rate
+                  << std::setw(14) << std::setprecision(1) << p50 << std::setw(14) << p99 << "\n";
+    }
+    return 0;
+}
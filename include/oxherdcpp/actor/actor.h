@@ -1,9 +1,17 @@
 #pragma once
 
+#include <concepts>
+#include <iterator>
+#include <span>
+#include <vector>
+
 #include <boost/asio.hpp>
 
 #include <oxherdcpp/actor/actor_id_generator.h>
+#include <oxherdcpp/actor/actor_options.h>
 #include <oxherdcpp/actor/actor_state.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/mailbox.h>
 #include <oxherdcpp/actor/message/message_dispatcher.h>
 #include <oxherdcpp/common/helper_macros.h>
 #include <oxherdcpp/common/memory.h>
@@ -12,6 +20,7 @@ namespace oxherdcpp
 {
 
 class ActorContext;
+class CoroutineFramePool;
 
 using Executor = boost::asio::any_io_executor;
 
@@ -25,10 +34,38 @@ class Actor : public std::enable_shared_from_this<Actor>
 
     auto Receive(MPtr<BaseMessage> message) -> void;
 
+    // Returns false when the mailbox overflow policy did not accept the message.
+    auto TryReceive(MPtr<BaseMessage> message) -> bool;
+
+    // Moves the messages in with a single scheduling decision and returns how many the mailbox accepted.
+    // A mailbox that may refuse or block a message takes the batch one message at a time.
+    auto ReceiveBatch(std::span<MPtr<BaseMessage>> messages) -> std::size_t;
+
+    // Pass move iterators to move the messages out of the range instead of copying them.
+    template <std::input_iterator Iterator>
+        requires std::convertible_to<std::iter_reference_t<Iterator>, MPtr<BaseMessage>>
+    auto ReceiveBatch(Iterator first, Iterator last) -> std::size_t
+    {
+        std::vector<MPtr<BaseMessage>> batch(first, last);
+        return ReceiveBatch(std::span{batch});
+    }
+
     auto GetState() -> ActorState &;
 
     auto SetContext(Uptr<ActorContext> context) -> void;
 
+    // Must be called before the actor receives its first message.
+    auto ApplyOptions(const ActorOptions &options) -> void;
+
+    [[nodiscard]] auto GetThroughput() const -> std::size_t;
+
+    [[nodiscard]] auto GetThroughputDeadline() const -> std::chrono::nanoseconds;
+
+    [[nodiscard]] auto GetMailbox() const -> const Mailbox &;
+
+    // User messages waiting for the actor to start or resume.
+    [[nodiscard]] auto GetStashSize() const -> std::size_t;
+
     [[nodiscard]] auto GetId() const -> ActorId;
 
     auto GetName() const -> std::string;
@@ -51,14 +88,25 @@ class Actor : public std::enable_shared_from_this<Actor>
     virtual auto OnTerminated() -> void;
 
   private:
+    friend class CoroutineAccess;
+
     virtual auto Behaviour(const MPtr<BaseMessage> &message) -> void = 0;
 
-    using MessageHandler = std::function<void()>;
-    using MessageHandlerMap = std::unordered_map<MessageTypeID, MessageHandler>;
+    using SystemMessageHandler = void (Actor::*)();
+    // Indexed by MessageTypeIndex
+    using SystemMessageHandlerTable = std::vector<SystemMessageHandler>;
+
+    // Built once and shared by every actor
+    [[nodiscard]] static auto GetSystemMessageHandlers() -> const SystemMessageHandlerTable &;
+
+    // A continuation is a turn handing over to the next one of the same actor
+    auto Schedule(bool is_continuation = false) -> void;
 
-    auto InitializeMessageHandlers() -> void;
+    auto PublishDeadLetter(MPtr<BaseMessage> message, DeadLetterReason reason) -> void;
 
-    auto ProcessMessage(const MPtr<BaseMessage> &message) -> void;
+    auto Run() -> void;
+
+    auto ProcessMessage(MPtr<BaseMessage> message) -> void;
 
     auto HandleGoStart() -> void;
 
@@ -70,16 +118,56 @@ class Actor : public std::enable_shared_from_this<Actor>
 
     auto HandleGoTerminate() -> void;
 
+    // False when type_index is not a system message with a handler
+    auto HandleSystemMessage(MessageTypeIndex type_index) -> bool;
+
+    auto HandleUserMessage(MPtr<BaseMessage> &&message) -> void;
+
+    // A borrowed message, such as the shared one of a broadcast envelope, is copied only when it is kept
+    // past the turn: stashed, dead-lettered or taken by a coroutine
     auto HandleUserMessage(const MPtr<BaseMessage> &message) -> void;
 
-    boost::asio::strand<Executor> strand_{};
+    template <typename MessagePtr> auto HandleUserMessageImpl(MessagePtr &&message) -> void;
+
+    // Resumes a coroutine only while running; see ResumeCoroutine
+    auto HandleResumption(MPtr<BaseMessage> message) -> void;
+
+    // Not running yet or paused: the states whose user messages are stashed
+    [[nodiscard]] auto IsStashing() const -> bool;
+
+    auto Stash(MPtr<BaseMessage> message) -> void;
+
+    // Resumes the parked coroutines, then replays the stash in arrival order, on the turn that started or
+    // resumed the actor
+    auto Unstash() -> void;
+
+    // Dead-letters what is left in the stash on stop or terminate, so a restart does not replay stale messages
+    auto DiscardStash() -> void;
+
+    auto ReportFailure(std::exception_ptr cause, MPtr<BaseMessage> message) -> void;
+
+    Executor executor_;
+    Mailbox mailbox_{};
+    std::size_t throughput_{kDefaultThroughput};
+    std::chrono::nanoseconds throughput_deadline_{0};
+    std::size_t stash_capacity_{kDefaultStashCapacity};
+    // Stays unallocated until the first message is stashed
+    std::vector<MPtr<BaseMessage>> stash_{};
+    // Coroutine resumptions that arrived while paused or starting. Not bounded by the stash capacity: the
+    // frames are already alive, dropping the resumption would only destroy them.
+    std::vector<MPtr<BaseMessage>> parked_resumptions_{};
     std::string name_;
     ActorId actor_id_;
     Uptr<ActorContext> context_;
 
     ActorState state_{};
-    MessageHandlerMap system_message_handlers_;
     MessageDispatcher message_dispatcher_{};
+
+    // Created with the first coroutine handler
+    Sptr<CoroutineFramePool> coroutine_frames_{};
+    const MPtr<BaseMessage> *current_message_{nullptr};
+
+    static thread_local Actor *current_actor_;
 };
 
 } // namespace oxherdcpp
\ No newline at end of file
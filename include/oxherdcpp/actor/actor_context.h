@@ -4,6 +4,7 @@
 
 #include <oxherdcpp/actor/actor.h>
 #include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/scheduler/timing_wheel.h>
 #include <oxherdcpp/actor/supervision/supervision_strategy.h>
 #include <oxherdcpp/common/helper_macros.h>
 
@@ -29,13 +30,22 @@ class ActorContext
     [[nodiscard]] auto GetSelf() const -> Actor &;
     [[nodiscard]] auto GetParent() const -> Wptr<Actor>;
     auto GetExecutor() -> boost::asio::any_io_executor;
+    [[nodiscard]] auto GetSystem() const -> Wptr<ActorSystemFacade>;
 
     template <typename ActorType, typename... Args>
     auto SpawnChild(std::string name, Uptr<SupervisionStrategy> supervision_strategy, Args &&...args) -> ActorRef
     {
-        auto factory{[this, name = std::move(name), actor_id = ActorIDGenerator::Generate(),
+        return SpawnChild<ActorType>(ActorOptions{}, std::move(name), std::move(supervision_strategy),
+                                     std::forward<Args>(args)...);
+    }
+
+    template <typename ActorType, typename... Args>
+    auto SpawnChild(const ActorOptions &options, std::string name, Uptr<SupervisionStrategy> supervision_strategy,
+                    Args &&...args) -> ActorRef
+    {
+        auto factory{[this, options, name = std::move(name), actor_id = ActorIDGenerator::Generate(),
                       ... args = std::forward<Args>(args)]() mutable {
-            return CreateActor<ActorType>(name, actor_id, std::forward<decltype(args)>(args)...);
+            return CreateActor<ActorType>(options, name, actor_id, std::forward<decltype(args)>(args)...);
         }};
         auto shared_factory{MakeSptr<decltype(factory)>(std::move(factory))};
 
@@ -43,19 +53,40 @@ class ActorContext
         return SpawnChildImpl(std::move(copyable_factory), std::move(supervision_strategy));
     }
 
-    auto HandleChildFailure(const MPtr<ActorFailureEvent> &failure_event) -> void;
+    // Timers of the actor system; the overloads without a target send the message to this actor.
+    auto ScheduleOnce(TimingWheel::Duration delay, MPtr<BaseMessage> message) -> TimerHandle;
+    auto ScheduleOnce(TimingWheel::Duration delay, ActorRef target, MPtr<BaseMessage> message) -> TimerHandle;
+    auto ScheduleAtFixedRate(TimingWheel::Duration initial_delay, TimingWheel::Duration interval,
+                             MPtr<BaseMessage> message) -> TimerHandle;
+    auto ScheduleAtFixedRate(TimingWheel::Duration initial_delay, TimingWheel::Duration interval, ActorRef target,
+                             MPtr<BaseMessage> message) -> TimerHandle;
+    auto Cancel(TimerHandle handle) -> bool;
+
+    // Null when no child with that id is supervised by this context.
+    [[nodiscard]] auto GetChild(ActorId child_id) const -> Sptr<Actor>;
+
+    // Applies the child's supervision strategy and returns the directive taken.
+    auto HandleChildFailure(const MPtr<ActorFailureEvent> &failure_event) -> Directive;
 
   private:
     template <typename ActorType, typename... Args>
-    auto CreateActor(std::string name, ActorId actor_id, Args &&...args) -> Sptr<Actor>
+    auto CreateActor(const ActorOptions &options, std::string name, ActorId actor_id, Args &&...args) -> Sptr<Actor>
     {
-        auto actor{MakeSptr<ActorType>(GetExecutor(), std::move(name), actor_id, std::forward<Args>(args)...)};
-        auto context{MakeUptr<ActorContext>(GetExecutor(), self_.shared_from_this(), *actor, system_facade_)};
+        const auto merged{MergeActorOptions(options, GetDefaultActorOptions())};
+        auto executor{SelectExecutor(merged, actor_id)};
+        auto actor{MakeSptr<ActorType>(executor, std::move(name), actor_id, std::forward<Args>(args)...)};
+        auto context{MakeUptr<ActorContext>(std::move(executor), self_.shared_from_this(), *actor, system_facade_)};
         actor->SetContext(std::move(context));
+        actor->ApplyOptions(merged);
 
         return actor;
     }
 
+    [[nodiscard]] auto GetDefaultActorOptions() const -> ActorOptions;
+
+    [[nodiscard]] auto SelectExecutor(const ActorOptions &options, ActorId actor_id) const
+        -> boost::asio::any_io_executor;
+
     auto SpawnChildImpl(std::function<Sptr<Actor>()> factory, Uptr<SupervisionStrategy> strategy) -> ActorRef;
 
     auto RestartChildActor(ChildInfo &child_info) -> void;
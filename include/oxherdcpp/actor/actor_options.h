@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace oxherdcpp
+{
+
+inline constexpr std::size_t kDefaultThroughput{64};
+inline constexpr std::size_t kDefaultStashCapacity{1024};
+
+enum class OverflowPolicy
+{
+    // The incoming message is discarded.
+    DropNewest,
+    // The incoming message is accepted and the oldest queued one is discarded when the actor dequeues. A
+    // consumer that falls kDropOldestHardCapFactor times the capacity behind has the newest dropped instead.
+    DropOldest,
+    // The incoming message is handed to the dead letters.
+    RejectToDeadLetters,
+    // The producer waits up to block_timeout for free space, then the message goes to the dead letters.
+    BlockProducer
+};
+
+struct MailboxConfig
+{
+    // Zero means unbounded.
+    std::size_t capacity{0};
+    OverflowPolicy overflow_policy{OverflowPolicy::DropNewest};
+    std::chrono::milliseconds block_timeout{100};
+};
+
+// Where a new actor runs when the system is sharded (SchedulerKind::Sharded); ignored otherwise.
+enum class ShardPlacement
+{
+    // Children stay on their parent's shard, top-level actors are hashed. Means system default.
+    Auto,
+    // ActorOptions::shard, modulo the shard count.
+    Explicit,
+    SameAsParent,
+    // Spread by actor id.
+    Hashed
+};
+
+struct ActorOptions
+{
+    // Messages an actor may process in one turn before yielding its worker thread. Zero means system default.
+    std::size_t throughput{0};
+    // Wall-clock limit of one turn, checked after every message. Zero means system default.
+    std::chrono::nanoseconds throughput_deadline{0};
+    // Empty means system default.
+    std::optional<MailboxConfig> mailbox{};
+    // User messages kept while the actor is starting or paused, replayed once it runs. Messages beyond it go to
+    // the dead letters, as does the stash itself when the actor stops or terminates. Empty means system default,
+    // zero drops them as they arrive.
+    std::optional<std::size_t> stash_capacity{};
+    ShardPlacement placement{ShardPlacement::Auto};
+    // Used by ShardPlacement::Explicit.
+    std::size_t shard{0};
+    // Name of a dispatcher registered on the system, e.g. "blocking". Empty means system default.
+    std::string dispatcher{};
+};
+
+[[nodiscard]] inline auto MergeActorOptions(const ActorOptions &options, const ActorOptions &defaults) -> ActorOptions
+{
+    ActorOptions merged{options};
+    if (merged.throughput == 0)
+    {
+        merged.throughput = defaults.throughput;
+    }
+    if (merged.throughput_deadline.count() == 0)
+    {
+        merged.throughput_deadline = defaults.throughput_deadline;
+    }
+    if (!merged.mailbox)
+    {
+        merged.mailbox = defaults.mailbox;
+    }
+    if (!merged.stash_capacity)
+    {
+        merged.stash_capacity = defaults.stash_capacity;
+    }
+    if (merged.placement == ShardPlacement::Auto)
+    {
+        merged.placement = defaults.placement;
+        merged.shard = defaults.shard;
+    }
+    if (merged.dispatcher.empty())
+    {
+        merged.dispatcher = defaults.dispatcher;
+    }
+    return merged;
+}
+
+} // namespace oxherdcpp
@@ -1,6 +1,14 @@
 #pragma once
 
+#include <chrono>
+#include <concepts>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <vector>
+
 #include <oxherdcpp/actor/actor_id_generator.h>
+#include <oxherdcpp/actor/ask.h>
 #include <oxherdcpp/actor/message/message.h>
 #include <oxherdcpp/common/memory.h>
 
@@ -19,9 +27,66 @@ class ActorRef
 
     auto Tell(MPtr<BaseMessage> message) noexcept -> void;
 
+    // Reports whether the recipient's mailbox accepted the message. A reference that is not resolved yet
+    // forwards the message through the registry and reports it as accepted.
+    auto TryTell(MPtr<BaseMessage> message) noexcept -> bool;
+
+    // Resolves the recipient once and hands it the whole batch, which is enqueued with a single scheduling
+    // decision. The messages are moved out of the span. A reference that is not resolved yet falls back to
+    // one Tell per message.
+    auto TellBatch(std::span<MPtr<BaseMessage>> messages) noexcept -> void;
+
+    // Pass move iterators to move the messages out of the range instead of copying them.
+    template <std::input_iterator Iterator>
+        requires std::convertible_to<std::iter_reference_t<Iterator>, MPtr<BaseMessage>>
+    auto TellBatch(Iterator first, Iterator last) -> void
+    {
+        std::vector<MPtr<BaseMessage>> batch(first, last);
+        TellBatch(std::span{batch});
+    }
+
+    // Sends the request with a reply slot attached and returns a future for the reply. The recipient answers
+    // through request->reply_to; no temporary actor and no registry lookup are involved.
+    template <typename Response, typename Request>
+        requires std::is_base_of_v<RequestMessage<Request>, Request>
+    auto Ask(MPtr<Request> request, const std::chrono::steady_clock::duration timeout) -> AskFuture<Response>
+    {
+        const auto deadline{std::chrono::steady_clock::now() + timeout};
+        auto slot{MakeSptr<ReplySlot>(RequestIdGenerator::Generate())};
+        SendRequest(slot, std::move(request), timeout);
+        return AskFuture<Response>{std::move(slot), deadline};
+    }
+
+    // Callback form: the callback gets the reply, or null when the timeout passes first or the reply is not a
+    // Response. It runs on the thread of the replying actor, or on the timer thread on timeout.
+    template <typename Response, typename Request, typename Callback>
+        requires std::is_base_of_v<RequestMessage<Request>, Request> &&
+                 std::is_invocable_v<Callback, MPtr<Response>>
+    auto Ask(MPtr<Request> request, const std::chrono::steady_clock::duration timeout, Callback callback) -> void
+    {
+        auto slot{MakeSptr<ReplySlot>(RequestIdGenerator::Generate(),
+                                      [callback = std::move(callback)](MPtr<BaseMessage> reply) mutable {
+                                          callback(Cast<Response>(reply));
+                                      })};
+        SendRequest(std::move(slot), std::move(request), timeout);
+    }
+
+    [[nodiscard]] auto GetId() const noexcept -> ActorId;
+
     explicit operator bool() const noexcept;
 
   private:
+    template <typename Request>
+    auto SendRequest(Sptr<ReplySlot> slot, MPtr<Request> request, const std::chrono::steady_clock::duration timeout)
+        -> void
+    {
+        request->reply_to = ReplyTo{slot};
+        ArmAskTimeout(std::move(slot), timeout);
+        Tell(std::move(request));
+    }
+
+    auto ArmAskTimeout(Sptr<ReplySlot> slot, std::chrono::steady_clock::duration timeout) -> void;
+
     ActorId actor_id_;
     Wptr<ActorSystemFacade> system_facade_;
     Wptr<Actor> cached_actor_;
@@ -28,11 +28,14 @@ struct UnregisterActorMessage final : Message<UnregisterActorMessage>
 
 struct FindActorMessage final : Message<FindActorMessage>
 {
-    FindActorMessage(const ActorId actor_id, ActorRef reply_to) : actor_id{actor_id}, reply_to{std::move(reply_to)}
+    FindActorMessage(const ActorId actor_id, ActorRef reply_to, const RequestId request_id = {})
+        : actor_id{actor_id}, reply_to{std::move(reply_to)}, request_id{request_id}
     {
     }
     ActorId actor_id;
     ActorRef reply_to;
+    // Echoed in the response so the caller can match it to the request
+    RequestId request_id;
 };
 
 struct FindActorWithCallbackMessage final : Message<FindActorWithCallbackMessage>
@@ -52,19 +55,22 @@ struct ActorFoundMessage final : Message<ActorFoundMessage>
 
 struct ActorFoundResponseMessage final : Message<ActorFoundResponseMessage>
 {
-    explicit ActorFoundResponseMessage(ActorRef actor_ref) : actor_ref{std::move(actor_ref)}
+    explicit ActorFoundResponseMessage(ActorRef actor_ref, const RequestId request_id = {})
+        : actor_ref{std::move(actor_ref)}, request_id{request_id}
     {
     }
     ActorRef actor_ref;
+    RequestId request_id;
 };
 
 struct ActorNotFoundResponseMessage final : Message<ActorNotFoundResponseMessage>
 {
-    explicit ActorNotFoundResponseMessage(const ActorId actor_id) : actor_id{actor_id}
+    explicit ActorNotFoundResponseMessage(const ActorId actor_id, const RequestId request_id = {})
+        : actor_id{actor_id}, request_id{request_id}
     {
     }
     ActorId actor_id;
-    std::uint64_t request_id{};
+    RequestId request_id;
 };
 
 struct ActorNotFoundMessage final : Message<ActorNotFoundMessage>
@@ -1,12 +1,19 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 
 #include <boost/asio.hpp>
 
 #include <oxherdcpp/actor/actor_context.h>
 #include <oxherdcpp/actor/actor_system_facade.h>
+#include <oxherdcpp/actor/broadcast.h>
+#include <oxherdcpp/actor/scheduler/dispatcher.h>
+#include <oxherdcpp/actor/scheduler/idle_strategy.h>
+#include <oxherdcpp/actor/scheduler/thread_affinity.h>
+#include <oxherdcpp/actor/scheduler/timing_wheel.h>
 #include <oxherdcpp/common/helper_macros.h>
 #include <oxherdcpp/common/memory.h>
 
@@ -14,6 +21,39 @@ namespace oxherdcpp
 {
 
 class Logger;
+class DeadLetterOffice;
+class WorkStealingScheduler;
+class ShardedRuntime;
+
+enum class SchedulerKind
+{
+    // All workers run one io_context and share its queue
+    SharedQueue,
+    // Per-worker run queues with work stealing, see WorkStealingScheduler
+    WorkStealing,
+    // One single-threaded io_context per worker, actors placed on shards, see ShardedRuntime
+    Sharded
+};
+
+struct ActorSystemConfig
+{
+    std::size_t thread_count{std::thread::hardware_concurrency()};
+    SchedulerKind scheduler{SchedulerKind::SharedQueue};
+    // Applies to the worker threads of every scheduler kind.
+    WorkerAffinity affinity{};
+    // What the worker threads of every scheduler kind do when they run out of work. Dispatchers always block.
+    IdleStrategy idle{};
+    // Resolution of ScheduleOnce and ScheduleAtFixedRate.
+    TimingWheel::Duration timer_tick{kDefaultTimerTick};
+    // Extra dispatchers actors can opt into through ActorOptions::dispatcher. A "blocking" thread pool of
+    // kDefaultBlockingThreadCount threads is added unless one with that name is listed.
+    std::vector<DispatcherConfig> dispatchers{};
+    // Applied to every actor whose ActorOptions leave a field unset.
+    ActorOptions default_actor_options{.throughput = kDefaultThroughput};
+    // How often idle chunks of the message pools go back to the system allocator, see TrimAllPools. Zero
+    // leaves trimming to the application.
+    TimingWheel::Duration pool_trim_interval{};
+};
 
 class ActorSystem final : public ActorSystemFacade, public std::enable_shared_from_this<ActorSystem>
 {
@@ -21,22 +61,77 @@ class ActorSystem final : public ActorSystemFacade, public std::enable_shared_fr
   public:
     explicit ActorSystem(std::string name, std::size_t thread_count = std::thread::hardware_concurrency());
 
+    ActorSystem(std::string name, ActorSystemConfig config);
+
     ~ActorSystem() override;
 
     auto GetActorRegistry() -> ActorRef override;
 
     auto DispatchMessage(ActorId actor_id, MPtr<BaseMessage> message) -> void override;
 
+    auto PublishDeadLetter(MPtr<DeadLetter> dead_letter) -> void override;
+
+    auto GetDeadLetters() -> ActorRef;
+
+    [[nodiscard]] auto GetDeadLetterCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetDefaultActorOptions() const -> ActorOptions override;
+
     auto GetExecutor() -> boost::asio::any_io_executor;
 
+    // Executor of the given shard, or GetExecutor() when the system is not sharded.
+    auto GetShardExecutor(std::size_t shard) -> boost::asio::any_io_executor;
+
+    // One when the system is not sharded.
+    [[nodiscard]] auto GetShardCount() const -> std::size_t;
+
+    // Idle transitions of the worker threads, summed over all workers.
+    [[nodiscard]] auto GetIdleStats() const -> IdleStats;
+
+    // Null when no dispatcher with that name is registered.
+    [[nodiscard]] auto GetDispatcher(std::string_view name) const -> Dispatcher *;
+
+    // Throws std::invalid_argument when options name an unknown dispatcher.
+    [[nodiscard]] auto SelectExecutor(const ActorOptions &options, ActorId actor_id,
+                                      const boost::asio::any_io_executor &parent_executor)
+        -> boost::asio::any_io_executor override;
+
+    auto ScheduleOnce(TimingWheel::Duration delay, ActorRef target, MPtr<BaseMessage> message)
+        -> TimerHandle override;
+
+    auto ScheduleAtFixedRate(TimingWheel::Duration initial_delay, TimingWheel::Duration interval, ActorRef target,
+                             MPtr<BaseMessage> message) -> TimerHandle override;
+
+    auto ScheduleCallback(TimingWheel::Duration delay, std::function<void()> callback) -> TimerHandle override;
+
+    auto Cancel(TimerHandle handle) -> bool override;
+
+    [[nodiscard]] auto GetTimingWheel() -> TimingWheel &;
+
+    // Large groups are enqueued in parallel on the system's worker threads, see oxherdcpp::Broadcast.
+    auto Broadcast(std::span<ActorRef> recipients, MPtr<BaseMessage> message, const BroadcastOptions &options = {})
+        -> void;
+
+    auto Broadcast(BroadcastGroup &group, MPtr<BaseMessage> message) -> void;
+
     auto Stop() -> void;
 
     template <typename ActorType, typename... Args>
     auto CreateActor(const std::string &name, Args &&...args) -> Sptr<ActorType>
     {
-        auto actor{MakeSptr<ActorType>(GetExecutor(), name, ActorIDGenerator::Generate(), std::forward<Args>(args)...)};
-        auto context{MakeUptr<ActorContext>(GetExecutor(), nullptr, *actor, weak_from_this())};
+        return CreateActor<ActorType>(ActorOptions{}, name, std::forward<Args>(args)...);
+    }
+
+    template <typename ActorType, typename... Args>
+    auto CreateActor(const ActorOptions &options, const std::string &name, Args &&...args) -> Sptr<ActorType>
+    {
+        const auto merged{MergeActorOptions(options, GetDefaultActorOptions())};
+        const auto actor_id{ActorIDGenerator::Generate()};
+        auto executor{SelectExecutor(merged, actor_id, {})};
+        auto actor{MakeSptr<ActorType>(executor, name, actor_id, std::forward<Args>(args)...)};
+        auto context{MakeUptr<ActorContext>(std::move(executor), nullptr, *actor, weak_from_this())};
         actor->SetContext(std::move(context));
+        actor->ApplyOptions(merged);
 
         return actor;
     }
@@ -46,17 +141,26 @@ class ActorSystem final : public ActorSystemFacade, public std::enable_shared_fr
 
     auto InitServices() -> void;
 
+    // Re-arms itself on the timer thread until Stop
+    auto SchedulePoolTrim() -> void;
+
     using WorkGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
     std::string name_;
     std::atomic<bool> is_running_{false};
+    ActorSystemConfig config_;
 
     // Execution context and thread pool
     boost::asio::io_context io_context_;
     std::optional<WorkGuard> work_guard_;
-    std::size_t thread_count_;
     std::vector<std::jthread> thread_pool_;
+    IdleCounters idle_counters_;
+    Uptr<WorkStealingScheduler> work_stealing_scheduler_;
+    Uptr<ShardedRuntime> sharded_runtime_;
+    std::vector<Uptr<Dispatcher>> dispatchers_;
+    Uptr<TimingWheel> timing_wheel_;
 
     Sptr<Actor> actor_registry_;
+    Sptr<DeadLetterOffice> dead_letters_;
 };
 
 } // namespace oxherdcpp
\ No newline at end of file
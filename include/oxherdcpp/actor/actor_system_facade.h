@@ -1,6 +1,11 @@
 #pragma once
 
+#include <boost/asio.hpp>
+
+#include <oxherdcpp/actor/actor_options.h>
 #include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/timing_wheel.h>
 
 namespace oxherdcpp
 {
@@ -12,5 +17,59 @@ class ActorSystemFacade
     [[nodiscard]] virtual auto GetActorRegistry() -> ActorRef = 0;
 
     virtual auto DispatchMessage(ActorId actor_id, MPtr<BaseMessage> message) -> void = 0;
+
+    // Receives messages that could not be delivered. Discards them unless overridden.
+    virtual auto PublishDeadLetter(MPtr<DeadLetter> dead_letter) -> void
+    {
+        (void)dead_letter;
+    }
+
+    [[nodiscard]] virtual auto GetDefaultActorOptions() const -> ActorOptions
+    {
+        return ActorOptions{.throughput = kDefaultThroughput};
+    }
+
+    // Picks the executor a new actor runs on. parent_executor is empty for top-level actors.
+    [[nodiscard]] virtual auto SelectExecutor(const ActorOptions &options, ActorId actor_id,
+                                              const boost::asio::any_io_executor &parent_executor)
+        -> boost::asio::any_io_executor
+    {
+        (void)options;
+        (void)actor_id;
+        return parent_executor;
+    }
+
+    // Delivers the message to the target after the delay. Returns an empty handle unless overridden.
+    virtual auto ScheduleOnce(TimingWheel::Duration delay, ActorRef target, MPtr<BaseMessage> message)
+        -> TimerHandle
+    {
+        (void)delay;
+        (void)target;
+        (void)message;
+        return TimerHandle{};
+    }
+
+    virtual auto ScheduleAtFixedRate(TimingWheel::Duration initial_delay, TimingWheel::Duration interval,
+                                     ActorRef target, MPtr<BaseMessage> message) -> TimerHandle
+    {
+        (void)initial_delay;
+        (void)interval;
+        (void)target;
+        (void)message;
+        return TimerHandle{};
+    }
+
+    virtual auto ScheduleCallback(TimingWheel::Duration delay, std::function<void()> callback) -> TimerHandle
+    {
+        (void)delay;
+        (void)callback;
+        return TimerHandle{};
+    }
+
+    virtual auto Cancel(TimerHandle handle) -> bool
+    {
+        (void)handle;
+        return false;
+    }
 };
 } // namespace oxherdcpp
\ No newline at end of file
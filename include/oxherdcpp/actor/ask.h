@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+#include <oxherdcpp/actor/message/message.h>
+#include <oxherdcpp/actor/scheduler/timer_handle.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+#include <oxherdcpp/common/uuid.h>
+
+namespace oxherdcpp
+{
+
+class ActorSystemFacade;
+
+using RequestId = std::size_t;
+
+using RequestIdGenerator = IDGenerator<struct RequestTag, RequestId>;
+
+enum class AskStatus
+{
+    Pending,
+    Replied,
+    TimedOut
+};
+
+class AskTimeoutError final : public std::runtime_error
+{
+  public:
+    explicit AskTimeoutError(RequestId request_id);
+
+    RequestId request_id;
+};
+
+// Where the reply to one Ask goes, in place of a temporary actor. Completed exactly once, by the first
+// reply or by the timeout, whichever comes first; later replies are dropped.
+class ReplySlot
+{
+    DISABLE_COPY_AND_MOVE(ReplySlot)
+
+  public:
+    // Runs on the thread that completes the slot with the reply, or with null on timeout.
+    using Callback = std::function<void(MPtr<BaseMessage>)>;
+
+    explicit ReplySlot(RequestId request_id, Callback callback = {});
+
+    auto Complete(MPtr<BaseMessage> reply) -> bool;
+
+    auto Expire() -> bool;
+
+    // Blocks until the slot completes or the deadline passes, and expires it in the latter case.
+    auto Wait(std::chrono::steady_clock::time_point deadline) -> AskStatus;
+
+    [[nodiscard]] auto GetStatus() const -> AskStatus;
+
+    // Null unless the status is Replied.
+    [[nodiscard]] auto GetReply() const -> MPtr<BaseMessage>;
+
+    [[nodiscard]] auto GetRequestId() const -> RequestId;
+
+    // Registers a single continuation run after the callback once the slot completes. False, and nothing
+    // registered, when the slot already completed.
+    auto OnComplete(std::function<void()> continuation) -> bool;
+
+    // The timer expiring this slot, cancelled once a reply arrives first.
+    auto SetTimeout(TimerHandle timer, Wptr<ActorSystemFacade> facade) -> void;
+
+  private:
+    auto Finish(AskStatus status, MPtr<BaseMessage> reply) -> bool;
+
+    RequestId request_id_;
+    Callback callback_;
+    std::atomic<bool> is_claimed_{false};
+    std::atomic<AskStatus> status_{AskStatus::Pending};
+    MPtr<BaseMessage> reply_{};
+    std::mutex mutex_;
+    std::condition_variable completed_;
+    std::function<void()> continuation_{};
+    TimerHandle timer_{};
+    Wptr<ActorSystemFacade> facade_{};
+};
+
+// Carried by a request so the recipient can answer the Ask that sent it.
+class ReplyTo
+{
+  public:
+    ReplyTo() = default;
+
+    explicit ReplyTo(Sptr<ReplySlot> slot);
+
+    // False when the request was not sent with Ask, or the Ask already completed or timed out.
+    auto Tell(MPtr<BaseMessage> reply) const -> bool;
+
+    [[nodiscard]] auto GetRequestId() const -> RequestId;
+
+    explicit operator bool() const noexcept;
+
+  private:
+    Sptr<ReplySlot> slot_{};
+};
+
+// Base of messages that can be sent with ActorRef::Ask.
+template <typename Derived> class RequestMessage : public Message<Derived>
+{
+  public:
+    ReplyTo reply_to{};
+
+  protected:
+    RequestMessage() = default;
+    ~RequestMessage() override = default;
+};
+
+template <typename Response> class AskFuture
+{
+  public:
+    AskFuture(Sptr<ReplySlot> slot, const std::chrono::steady_clock::time_point deadline)
+        : slot_{std::move(slot)}, deadline_{deadline}
+    {
+    }
+
+    [[nodiscard]] auto IsReady() const -> bool
+    {
+        return slot_->GetStatus() != AskStatus::Pending;
+    }
+
+    [[nodiscard]] auto GetRequestId() const -> RequestId
+    {
+        return slot_->GetRequestId();
+    }
+
+    // Blocks until the reply arrives and throws AskTimeoutError once the timeout passes. Returns null when
+    // the reply is not a Response. Blocking a worker thread on a reply it would have to process deadlocks.
+    auto Get() -> MPtr<Response>
+    {
+        if (slot_->Wait(deadline_) != AskStatus::Replied)
+        {
+            throw AskTimeoutError{slot_->GetRequestId()};
+        }
+        return Cast<Response>(slot_->GetReply());
+    }
+
+    [[nodiscard]] auto GetSlot() const -> const Sptr<ReplySlot> &
+    {
+        return slot_;
+    }
+
+  private:
+    Sptr<ReplySlot> slot_;
+    std::chrono::steady_clock::time_point deadline_;
+};
+
+} // namespace oxherdcpp
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/message/message.h>
+
+namespace oxherdcpp
+{
+
+inline constexpr std::size_t kDefaultBroadcastShardSize{256};
+inline constexpr std::size_t kDefaultBroadcastParallelThreshold{4096};
+
+struct BroadcastOptions
+{
+    // Recipients that share one envelope and are enqueued by one thread.
+    std::size_t shard_size{kDefaultBroadcastShardSize};
+    // Recipient count from which the shards are enqueued in parallel on the executor. Zero means never.
+    std::size_t parallel_threshold{kDefaultBroadcastParallelThreshold};
+};
+
+// Carries a broadcast message to the recipients of one shard. Mailboxes hold the envelope, so the shared
+// message is referenced once per shard instead of once per recipient. The sender takes the envelope's
+// references for the whole shard in one atomic add; each recipient still releases its own with an atomic
+// decrement on its thread, which spreads that traffic over one envelope per shard rather than one message.
+// Actors unwrap it before processing and borrow the message from the envelope, copying the reference only
+// to keep it past the turn: Behaviour and dead letters see the message itself.
+struct BroadcastEnvelope final : Message<BroadcastEnvelope>
+{
+    explicit BroadcastEnvelope(BaseMessagePtr message) : message{std::move(message)}
+    {
+    }
+
+    // Keeps broadcast system messages in the system lane
+    [[nodiscard]] auto IsSystemMessage() const -> bool override
+    {
+        return message->IsSystemMessage();
+    }
+
+    BaseMessagePtr message;
+};
+
+// Delivers one message to every recipient without copying it; recipients must treat it as immutable.
+// With an executor, groups of at least parallel_threshold recipients are enqueued by the executor's threads
+// as well as the caller's, which returns once every shard is enqueued.
+auto Broadcast(std::span<ActorRef> recipients, MPtr<BaseMessage> message, const BroadcastOptions &options = {},
+               const boost::asio::any_io_executor &executor = {}) -> void;
+
+// A reusable set of recipients for Broadcast. Not thread safe, like a plain container.
+class BroadcastGroup
+{
+  public:
+    explicit BroadcastGroup(BroadcastOptions options = {});
+
+    explicit BroadcastGroup(std::vector<ActorRef> recipients, BroadcastOptions options = {});
+
+    auto Add(ActorRef recipient) -> void;
+
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+
+    [[nodiscard]] auto GetOptions() const -> const BroadcastOptions &;
+
+    auto Broadcast(MPtr<BaseMessage> message, const boost::asio::any_io_executor &executor = {}) -> void;
+
+  private:
+    std::vector<ActorRef> recipients_;
+    BroadcastOptions options_;
+};
+
+} // namespace oxherdcpp
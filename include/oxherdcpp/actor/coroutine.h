@@ -0,0 +1,192 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/ask.h>
+#include <oxherdcpp/actor/message/message.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+
+namespace oxherdcpp
+{
+
+class Actor;
+class ActorSystemFacade;
+
+// Recycles the coroutine frames of one actor. Frames are created on the actor's turn but may be released
+// from another thread once the actor is gone, hence the lock; it is uncontended otherwise.
+class CoroutineFramePool
+{
+    DISABLE_COPY_AND_MOVE(CoroutineFramePool)
+
+  public:
+    CoroutineFramePool() = default;
+
+    auto Allocate(std::size_t size) -> void *;
+
+    auto Deallocate(void *ptr, std::size_t size) -> void;
+
+    [[nodiscard]] auto GetLiveFrameCount() const -> std::size_t;
+
+  private:
+    mutable std::mutex mutex_;
+    std::pmr::unsynchronized_pool_resource pool_;
+    std::size_t live_frames_{0};
+};
+
+// Gives the coroutine machinery access to the actor it runs on.
+class CoroutineAccess
+{
+  public:
+    // The actor whose turn is running on this thread, null outside of a turn.
+    [[nodiscard]] static auto GetCurrentActor() -> Actor *;
+
+    [[nodiscard]] static auto GetFramePool(Actor &actor) -> Sptr<CoroutineFramePool>;
+
+    [[nodiscard]] static auto GetCurrentMessage(const Actor &actor) -> MPtr<BaseMessage>;
+
+    [[nodiscard]] static auto GetSystem(const Actor &actor) -> Sptr<ActorSystemFacade>;
+
+    static auto ReportFailure(Actor &actor, std::exception_ptr cause, const MPtr<BaseMessage> &message) -> void;
+};
+
+// Return type of coroutine message handlers. The coroutine starts right away on the actor's turn and every
+// resumption is another turn of the same actor, so handler state needs no locking. Nothing awaits the task:
+// an exception escaping the coroutine fails the actor like one thrown from Behaviour. Handlers must take
+// their message by value, a reference would dangle after the first suspension.
+class ActorTask
+{
+  public:
+    class promise_type
+    {
+      public:
+        promise_type();
+
+        // Frames come from the pool of the actor that starts the coroutine
+        static auto operator new(std::size_t size) -> void *;
+
+        static auto operator delete(void *ptr, std::size_t size) noexcept -> void;
+
+        auto get_return_object() noexcept -> ActorTask
+        {
+            return ActorTask{};
+        }
+
+        auto initial_suspend() noexcept -> std::suspend_never
+        {
+            return {};
+        }
+
+        auto final_suspend() noexcept -> std::suspend_never
+        {
+            return {};
+        }
+
+        auto return_void() noexcept -> void
+        {
+        }
+
+        auto unhandled_exception() noexcept -> void;
+
+      private:
+        Wptr<Actor> actor_;
+        MPtr<BaseMessage> message_;
+    };
+};
+
+// Carries a suspended coroutine back into its actor's mailbox. The system lane keeps resumptions from being
+// dropped by a bounded mailbox. A coroutine only runs while its actor is running: a resumption arriving
+// while the actor is paused or still starting is parked until it runs again, and one arriving after stop,
+// termination or a failure is dropped. A coroutine that is never resumed is destroyed with the message,
+// which runs the destructors of its locals but nothing past the co_await; parked resumptions are dropped
+// the same way when the actor stops.
+struct ResumeCoroutine final : SystemMessage<ResumeCoroutine>
+{
+    explicit ResumeCoroutine(const std::coroutine_handle<> handle) : handle{handle}
+    {
+    }
+
+    ~ResumeCoroutine() override;
+
+    auto Resume() -> void;
+
+    std::coroutine_handle<> handle;
+};
+
+// Suspends the coroutine and resumes it on a later turn of the actor running it.
+class ActorAwaiter
+{
+  protected:
+    // False when no actor is running on this thread, the coroutine then carries on without suspending.
+    auto Suspend(std::coroutine_handle<> handle) -> bool;
+
+    // Callable from any thread. Destroys the coroutine when its actor is gone.
+    auto Resume() -> void;
+
+    [[nodiscard]] auto GetSystem() const -> Sptr<ActorSystemFacade>;
+
+  private:
+    Wptr<Actor> actor_{};
+    std::coroutine_handle<> handle_{};
+};
+
+template <typename Response> class AskAwaiter final : public ActorAwaiter
+{
+  public:
+    explicit AskAwaiter(AskFuture<Response> future) : future_{std::move(future)}
+    {
+    }
+
+    [[nodiscard]] auto await_ready() const -> bool
+    {
+        return future_.IsReady();
+    }
+
+    auto await_suspend(const std::coroutine_handle<> handle) -> bool
+    {
+        return Suspend(handle) && future_.GetSlot()->OnComplete([this] { Resume(); });
+    }
+
+    // Throws AskTimeoutError like AskFuture::Get. Outside of an actor it blocks until the reply arrives.
+    auto await_resume() -> MPtr<Response>
+    {
+        return future_.Get();
+    }
+
+  private:
+    AskFuture<Response> future_;
+};
+
+template <typename Response> auto operator co_await(AskFuture<Response> future) -> AskAwaiter<Response>
+{
+    return AskAwaiter<Response>{std::move(future)};
+}
+
+class SleepAwaiter final : public ActorAwaiter
+{
+  public:
+    explicit SleepAwaiter(std::chrono::steady_clock::duration delay);
+
+    [[nodiscard]] auto await_ready() const -> bool;
+
+    // Resumes right away, without sleeping, when the actor has no system to time the delay.
+    auto await_suspend(std::coroutine_handle<> handle) -> bool;
+
+    auto await_resume() const noexcept -> void
+    {
+    }
+
+  private:
+    std::chrono::steady_clock::duration delay_;
+};
+
+// co_await Sleep(delay) resumes the coroutine on the actor's turn after the delay, on the system's timing wheel.
+[[nodiscard]] auto Sleep(std::chrono::steady_clock::duration delay) -> SleepAwaiter;
+
+} // namespace oxherdcpp
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/events.h>
+
+namespace oxherdcpp
+{
+
+struct SubscribeDeadLettersMessage final : Message<SubscribeDeadLettersMessage>
+{
+    explicit SubscribeDeadLettersMessage(ActorRef subscriber) : subscriber{std::move(subscriber)}
+    {
+    }
+    ActorRef subscriber;
+};
+
+class DeadLetterOffice final : public Actor
+{
+  public:
+    explicit DeadLetterOffice(const Executor &executor, const std::string &name, ActorId actor_id);
+
+    [[nodiscard]] auto GetDeadLetterCount() const -> std::size_t;
+
+  private:
+    auto Behaviour(const MPtr<BaseMessage> &message) -> void override;
+
+    auto HandleDeadLetter(const MPtr<DeadLetter> &message) -> void;
+
+    auto HandleSubscribe(const MPtr<SubscribeDeadLettersMessage> &message) -> void;
+
+    auto OnTerminate() -> void override;
+
+    std::atomic<std::size_t> dead_letter_count_{0};
+    std::vector<ActorRef> subscribers_{};
+};
+
+} // namespace oxherdcpp
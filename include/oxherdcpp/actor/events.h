@@ -15,23 +15,45 @@ struct ActorFailureEvent final : Message<ActorFailureEvent>
     BaseMessagePtr failed_message;
 };
 
-struct GoStartActor final : Message<GoStartActor>
+enum class DeadLetterReason
 {
+    MailboxOverflow,
+    // A router had no live routee for the message
+    NoRoutee,
+    // The actor was not running and its stash was full
+    StashOverflow,
+    // The actor stopped or terminated with the message still stashed
+    StashDiscarded
 };
 
-struct GoStopActor final : Message<GoStopActor>
+struct DeadLetter final : Message<DeadLetter>
 {
+    DeadLetter(const ActorId recipient, BaseMessagePtr message, const DeadLetterReason reason)
+        : recipient{recipient}, message{std::move(message)}, reason{reason}
+    {
+    }
+    ActorId recipient;
+    BaseMessagePtr message;
+    DeadLetterReason reason;
 };
 
-struct GoPauseActor final : Message<GoPauseActor>
+struct GoStartActor final : SystemMessage<GoStartActor>
 {
 };
 
-struct GoResumeActor final : Message<GoResumeActor>
+struct GoStopActor final : SystemMessage<GoStopActor>
 {
 };
 
-struct GoTerminateActor final : Message<GoTerminateActor>
+struct GoPauseActor final : SystemMessage<GoPauseActor>
+{
+};
+
+struct GoResumeActor final : SystemMessage<GoResumeActor>
+{
+};
+
+struct GoTerminateActor final : SystemMessage<GoTerminateActor>
 {
 };
 } // namespace oxherdcpp
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <span>
+
+#include <oxherdcpp/actor/actor_options.h>
+#include <oxherdcpp/actor/message/message.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/mpsc_queue.h>
+
+namespace oxherdcpp
+{
+
+// Under DropOldest the user lane holds at most this many times the capacity; past that the newest message
+// is dropped instead, since producers cannot evict from the head of the queue.
+inline constexpr std::size_t kDropOldestHardCapFactor{2};
+
+struct EnqueueResult
+{
+    bool accepted{false};
+    // True when the caller is responsible for scheduling the owner.
+    bool needs_schedule{false};
+    // Set when the overflow policy hands the message back for dead-letter delivery.
+    MPtr<BaseMessage> rejected{};
+};
+
+// Per-actor message queue. The owner is scheduled only on the idle -> scheduled transition,
+// so a burst of messages costs a single executor hop instead of one per message.
+// System messages use their own unbounded lane which is always drained first.
+class Mailbox
+{
+    DISABLE_COPY_AND_MOVE(Mailbox)
+  public:
+    Mailbox() = default;
+
+    // Must be called before the first Enqueue.
+    auto Configure(const MailboxConfig &config) -> void;
+
+    auto Enqueue(MPtr<BaseMessage> message) -> EnqueueResult;
+
+    // Moves the whole batch in and returns true when the caller is responsible for scheduling the owner.
+    // User messages are published with one queue exchange and the owner is scheduled at most once.
+    // Requires CanEnqueueBatch.
+    auto EnqueueBatch(std::span<MPtr<BaseMessage>> messages) -> bool;
+
+    // True when the overflow policy never refuses nor blocks a message, so a batch can go in at once.
+    [[nodiscard]] auto CanEnqueueBatch() const -> bool;
+
+    // Consumer side: returns nullptr when there is nothing to process right now.
+    auto Dequeue() -> MPtr<BaseMessage>;
+
+    // Consumer side: marks the end of a turn. Returns true when messages arrived meanwhile
+    // and the caller must schedule the owner again.
+    auto CompleteTurn() -> bool;
+
+    [[nodiscard]] auto IsScheduled() const -> bool;
+
+    // Approximate number of queued user messages.
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+
+    [[nodiscard]] auto GetDroppedCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetConfig() const -> const MailboxConfig &;
+
+  private:
+    auto TrySchedule() -> bool;
+
+    auto TryReserve() -> bool;
+
+    auto WaitForCapacity() -> bool;
+
+    auto NotifyBlockedProducers() -> void;
+
+    MailboxConfig config_{};
+    MpscQueue<MPtr<BaseMessage>> system_queue_;
+    MpscQueue<MPtr<BaseMessage>> queue_;
+    alignas(kCacheLineSize) std::atomic<bool> scheduled_{false};
+    alignas(kCacheLineSize) std::atomic<std::size_t> size_{0};
+    std::atomic<std::size_t> dropped_{0};
+
+    std::atomic<std::size_t> blocked_producers_{0};
+    std::mutex capacity_mutex_;
+    std::condition_variable capacity_available_;
+};
+
+} // namespace oxherdcpp
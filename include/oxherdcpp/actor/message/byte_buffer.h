@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/intrusive_ptr.hpp>
+
+namespace oxherdcpp
+{
+
+// Capacities of the pooled backing blocks; a larger buffer gets a block of its own from the heap
+inline constexpr std::array<std::size_t, 4> kByteBlockSizeClasses{256, 1024, 4096, 16 * 1024};
+
+// Storage of one or more ByteBuffers, freed with the last of them. The bytes follow the header. Counted on
+// its own, so a payload outlives the message that brought it and can be kept by several messages at once.
+struct ByteBlock
+{
+    static constexpr std::uint32_t kUnpooled{kByteBlockSizeClasses.size()};
+
+    // The bytes are left uninitialized
+    static auto Allocate(std::size_t capacity) -> boost::intrusive_ptr<ByteBlock>;
+
+    auto GetBytes() noexcept -> std::byte *
+    {
+        return reinterpret_cast<std::byte *>(this + 1);
+    }
+
+    friend auto intrusive_ptr_add_ref(ByteBlock *block) noexcept -> void
+    {
+        block->ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    friend auto intrusive_ptr_release(ByteBlock *block) noexcept -> void
+    {
+        if (block->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Free(block);
+        }
+    }
+
+    std::atomic<std::uint32_t> ref_count{0};
+    // Index into kByteBlockSizeClasses, or kUnpooled
+    std::uint32_t size_class{kUnpooled};
+    std::size_t capacity{0};
+
+  private:
+    static auto Free(ByteBlock *block) noexcept -> void;
+};
+
+// Immutable contiguous bytes. Copies and slices share the block instead of copying the bytes, so a message
+// can carry a large payload and forward it, or hand it to a logger, for the cost of a reference count.
+class ByteBuffer
+{
+  public:
+    static constexpr std::size_t kToEnd{std::numeric_limits<std::size_t>::max()};
+
+    ByteBuffer() = default;
+
+    static auto Copy(std::span<const std::byte> bytes) -> ByteBuffer;
+
+    static auto Copy(std::string_view text) -> ByteBuffer;
+
+    // Lets fill write the bytes of a new block once, then freezes them
+    template <typename Fill>
+        requires std::invocable<Fill &, std::span<std::byte>>
+    static auto Build(const std::size_t size, Fill &&fill) -> ByteBuffer
+    {
+        auto block{ByteBlock::Allocate(size)};
+        auto *const data{block->GetBytes()};
+        fill(std::span<std::byte>{data, size});
+        return ByteBuffer{std::move(block), data, size};
+    }
+
+    [[nodiscard]] auto GetData() const noexcept -> const std::byte *
+    {
+        return data_;
+    }
+
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool
+    {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto GetBytes() const noexcept -> std::span<const std::byte>
+    {
+        return {data_, size_};
+    }
+
+    [[nodiscard]] auto GetText() const noexcept -> std::string_view
+    {
+        return {reinterpret_cast<const char *>(data_), size_};
+    }
+
+    // Shares the block. Throws std::out_of_range when offset is past the end; length is clamped.
+    [[nodiscard]] auto Slice(std::size_t offset, std::size_t length = kToEnd) const -> ByteBuffer;
+
+    // Buffers sharing the block, this one included
+    [[nodiscard]] auto GetUseCount() const noexcept -> std::uint32_t;
+
+    // Compares the bytes, not the blocks
+    friend auto operator==(const ByteBuffer &lhs, const ByteBuffer &rhs) noexcept -> bool;
+
+  private:
+    ByteBuffer(boost::intrusive_ptr<ByteBlock> block, const std::byte *data, std::size_t size) noexcept;
+
+    boost::intrusive_ptr<ByteBlock> block_{};
+    const std::byte *data_{nullptr};
+    std::size_t size_{0};
+};
+
+// Immutable bytes made of ByteBuffer segments. Appending or slicing links segments, it never copies bytes;
+// a writer walks GetSegments, and only Flatten and CopyTo copy.
+class ByteChain
+{
+  public:
+    ByteChain() = default;
+
+    explicit ByteChain(ByteBuffer buffer);
+
+    // Empty buffers are skipped
+    auto Append(ByteBuffer buffer) -> ByteChain &;
+
+    auto Append(const ByteChain &chain) -> ByteChain &;
+
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool
+    {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto GetSegments() const noexcept -> std::span<const ByteBuffer>
+    {
+        return segments_;
+    }
+
+    // Throws std::out_of_range when offset is past the end; length is clamped
+    [[nodiscard]] auto Slice(std::size_t offset, std::size_t length = ByteBuffer::kToEnd) const -> ByteChain;
+
+    // Copies as many bytes as fit and returns their count
+    auto CopyTo(std::span<std::byte> destination) const noexcept -> std::size_t;
+
+    // The bytes as one buffer; copies only when there is more than one segment
+    [[nodiscard]] auto Flatten() const -> ByteBuffer;
+
+    friend auto operator==(const ByteChain &lhs, const ByteChain &rhs) noexcept -> bool;
+
+  private:
+    std::vector<ByteBuffer> segments_{};
+    std::size_t size_{0};
+};
+
+} // namespace oxherdcpp
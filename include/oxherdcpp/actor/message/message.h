@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include <boost/intrusive_ptr.hpp>
-#include <boost/smart_ptr/intrusive_ref_counter.hpp>
 
 #include <oxherdcpp/actor/message/message_id_generator.h>
 #include <oxherdcpp/actor/message/object_pool.h>
@@ -10,16 +12,127 @@
 namespace oxherdcpp
 {
 
-class BaseMessage : public boost::intrusive_ref_counter<BaseMessage>
+// A message type that declares
+//     static constexpr bool kThreadConfined{true};
+// promises that all references to one of its messages are held by one thread at a time. Handing the only
+// reference to another thread through a mailbox is fine, the queue orders the two threads; sharing it, as a
+// broadcast or a copy kept by the sender does, is not. Its reference count then skips the locked
+// read-modify-write instructions.
+template <typename MessageType>
+concept ThreadConfinedMessage = requires {
+    requires MessageType::kThreadConfined;
+};
+
+class BaseMessage
 {
   public:
     virtual ~BaseMessage() = default;
     [[nodiscard]] virtual auto GetTypeId() const -> MessageTypeID = 0;
 
+    // System messages travel in a separate mailbox lane that is drained before user messages.
+    [[nodiscard]] virtual auto IsSystemMessage() const -> bool
+    {
+        return false;
+    }
+
+    [[nodiscard]] auto GetTypeIndex() const noexcept -> MessageTypeIndex
+    {
+        return type_index_;
+    }
+
     template <typename T> [[nodiscard]] auto IsA() const -> bool
     {
-        return GetTypeId() == GetTypeHash<T>();
+        if constexpr (requires { T::GetClassTypeIndex(); })
+        {
+            return type_index_ == T::GetClassTypeIndex();
+        }
+        else
+        {
+            return GetTypeId() == GetTypeHash<T>();
+        }
+    }
+
+    [[nodiscard]] auto use_count() const noexcept -> std::uint32_t // NOLINT(readability-identifier-naming)
+    {
+        return ref_count_.load(std::memory_order_relaxed) & ~kThreadConfinedBit;
+    }
+
+    [[nodiscard]] auto IsThreadConfined() const noexcept -> bool
+    {
+        return (ref_count_.load(std::memory_order_relaxed) & kThreadConfinedBit) != 0;
+    }
+
+    // Takes count references in one step, for a sender about to hand the message to count owners that adopt
+    // them, e.g. MPtr<BaseMessage>{message, false}
+    auto AddReferences(const std::uint32_t count) const noexcept -> void
+    {
+        if (const auto current{ref_count_.load(std::memory_order_relaxed)}; (current & kThreadConfinedBit) != 0)
+        {
+            ref_count_.store(current + count, std::memory_order_relaxed);
+            return;
+        }
+        ref_count_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    friend auto intrusive_ptr_add_ref(const BaseMessage *message) noexcept -> void
+    {
+        auto &ref_count{message->ref_count_};
+        if (const auto count{ref_count.load(std::memory_order_relaxed)}; (count & kThreadConfinedBit) != 0)
+        {
+            ref_count.store(count + 1, std::memory_order_relaxed);
+            return;
+        }
+        ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    friend auto intrusive_ptr_release(const BaseMessage *message) noexcept -> void
+    {
+        auto &ref_count{message->ref_count_};
+        auto count{ref_count.load(std::memory_order_relaxed)};
+        if ((count & kThreadConfinedBit) != 0)
+        {
+            ref_count.store(--count, std::memory_order_relaxed);
+        }
+        else
+        {
+            // Release, and acquire before deleting, so the last owner sees every write of the others
+            count = ref_count.fetch_sub(1, std::memory_order_release) - 1;
+            if (count == 0)
+            {
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+        }
+        if ((count & ~kThreadConfinedBit) == 0)
+        {
+            delete message;
+        }
+    }
+
+  protected:
+    BaseMessage(const MessageTypeIndex type_index, const bool thread_confined)
+        : ref_count_{thread_confined ? kThreadConfinedBit : 0}, type_index_{type_index}
+    {
     }
+
+    // A copy is a new message with no references yet
+    BaseMessage(const BaseMessage &other) noexcept
+        : ref_count_{other.ref_count_.load(std::memory_order_relaxed) & kThreadConfinedBit},
+          type_index_{other.type_index_}
+    {
+    }
+
+    auto operator=(const BaseMessage &) noexcept -> BaseMessage &
+    {
+        return *this;
+    }
+
+  private:
+    // The top bit of the count marks a thread confined message, fixed for its lifetime
+    static constexpr std::uint32_t kThreadConfinedBit{std::uint32_t{1} << 31};
+
+    mutable std::atomic<std::uint32_t> ref_count_;
+    // Sits next to the reference count after the vtable pointer, messages do not grow
+    MessageTypeIndex type_index_;
 };
 
 template <typename Derived> class Message : public BaseMessage
@@ -32,14 +145,46 @@ template <typename Derived> class Message : public BaseMessage
         return GetTypeHash<Derived>();
     }
 
-    static auto GetPoolStats() -> PoolStats &
+    // Assigned on first use, see MessageTypeIndex
+    static auto GetClassTypeIndex() -> MessageTypeIndex
+    {
+        static const MessageTypeIndex type_index{AllocateMessageTypeIndex()};
+        return type_index;
+    }
+
+    static auto GetPoolStats() -> const PoolStats &
     {
         return pool_.GetStats();
     }
 
     static auto ReleasePool() -> void
     {
-        pool_.release();
+        pool_.Release();
+    }
+
+    static auto ReservePool(const std::size_t message_count) -> bool
+    {
+        return pool_.Reserve(message_count);
+    }
+
+    static auto SetPoolLimits(const PoolLimits limits) -> void
+    {
+        pool_.SetLimits(limits);
+    }
+
+    static auto TrimPool() -> std::size_t
+    {
+        return pool_.Trim();
+    }
+
+    static auto GetPoolHeldBytes() -> std::size_t
+    {
+        return pool_.GetHeldBytes();
+    }
+
+    static auto GetPoolReport() -> PoolReport
+    {
+        return pool_.GetReport();
     }
 
     [[nodiscard]] constexpr auto GetTypeId() const -> MessageTypeID override
@@ -58,7 +203,7 @@ template <typename Derived> class Message : public BaseMessage
         {
             return ::operator new(size);
         }
-        return pool_.allocate(size, alignof(Derived));
+        return pool_.Allocate(GetThreadCache());
     }
 
     static void operator delete(void *ptr, std::size_t size) noexcept
@@ -72,7 +217,7 @@ template <typename Derived> class Message : public BaseMessage
             ::operator delete(ptr, size);
             return;
         }
-        pool_.deallocate(ptr, size, alignof(Derived));
+        pool_.Deallocate(GetThreadCache(), ptr);
     }
 
     static void operator delete(void *ptr) noexcept
@@ -81,15 +226,36 @@ template <typename Derived> class Message : public BaseMessage
         {
             return;
         }
-        pool_.deallocate(ptr, sizeof(Derived), alignof(Derived));
+        pool_.Deallocate(GetThreadCache(), ptr);
     }
 
   protected:
-    Message() = default;
+    Message() : BaseMessage{GetClassTypeIndex(), ThreadConfinedMessage<Derived>}
+    {
+    }
     ~Message() override = default;
 
   private:
-    inline static MonitoredPoolResource pool_{};
+    static auto GetThreadCache() -> PoolThreadCache &
+    {
+        thread_local PoolThreadCache cache{pool_};
+        return cache;
+    }
+
+    inline static CachedPool pool_{sizeof(Derived), alignof(Derived), GetTypeName<Derived>()};
+};
+
+template <typename Derived> class SystemMessage : public Message<Derived>
+{
+  public:
+    [[nodiscard]] auto IsSystemMessage() const -> bool final
+    {
+        return true;
+    }
+
+  protected:
+    SystemMessage() = default;
+    ~SystemMessage() override = default;
 };
 
 template <typename T> using MPtr = boost::intrusive_ptr<T>;
@@ -117,6 +283,22 @@ template <typename... MessageTypes> void ReleaseAllMessagePools()
     (ReleaseMessagePoolMemory<MessageTypes>(), ...);
 }
 
+// Pre-populates the pool of T so the first message_count messages do not reach the system allocator
+template <typename T> auto ReserveMessagePool(const std::size_t message_count) -> bool
+{
+    return T::ReservePool(message_count);
+}
+
+template <typename T> auto SetMessagePoolLimits(const PoolLimits limits) -> void
+{
+    T::SetPoolLimits(limits);
+}
+
+template <typename T> auto TrimMessagePool() -> std::size_t
+{
+    return T::TrimPool();
+}
+
 template <typename T, typename U> [[nodiscard]] auto Cast(const MPtr<U> &msg) -> MPtr<T>
 {
     using NakedT = std::remove_const_t<T>;
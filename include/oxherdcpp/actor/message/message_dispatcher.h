@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include <oxherdcpp/actor/message/message.h>
 
 namespace oxherdcpp
@@ -9,14 +12,19 @@ class MessageDispatcher
 {
   public:
     template <typename MessageType> using Handler = std::function<void(const MPtr<MessageType> &message)>;
-    using HandlerMap = std::unordered_map<MessageTypeID, Handler<BaseMessage>>;
+    // Indexed by MessageTypeIndex, empty where no handler is registered
+    using HandlerTable = std::vector<Handler<BaseMessage>>;
 
     MessageDispatcher() = default;
 
     template <typename MessageType> auto RegisterHandler(Handler<MessageType> handler) -> MessageDispatcher &
     {
-        auto type_id{GetTypeHash<MessageType>()};
-        handlers_[type_id] = [handler = std::move(handler)](const MPtr<BaseMessage> &message) {
+        const auto type_index{MessageType::GetClassTypeIndex()};
+        if (type_index >= handlers_.size())
+        {
+            handlers_.resize(type_index + 1);
+        }
+        handlers_[type_index] = [handler = std::move(handler)](const MPtr<BaseMessage> &message) {
             handler(Cast<MessageType>(message));
         };
         return *this;
@@ -25,7 +33,7 @@ class MessageDispatcher
     auto Dispatch(const MPtr<BaseMessage> &message) -> void;
 
   private:
-    HandlerMap handlers_{};
+    HandlerTable handlers_{};
 };
 
 } // namespace oxherdcpp
\ No newline at end of file
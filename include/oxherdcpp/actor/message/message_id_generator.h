@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <oxherdcpp/common/uuid.h>
 
 namespace oxherdcpp
@@ -9,4 +11,14 @@ using MessageTypeID = std::size_t;
 
 using MessageIDGenerator = IDGenerator<struct MessageTag, MessageTypeID>;
 
+// Dense per-type index for flat handler tables. Unlike the hashed MessageTypeID it cannot collide, but it
+// depends on the order types are first used and so differs between runs.
+using MessageTypeIndex = std::uint32_t;
+
+// Hands out 0, 1, 2... Defined in the library so every module shares one counter.
+auto AllocateMessageTypeIndex() -> MessageTypeIndex;
+
+// Every index handed out so far is below it.
+[[nodiscard]] auto GetMessageTypeCount() -> std::size_t;
+
 } // namespace oxherdcpp
@@ -1,34 +1,380 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <cstdint>
+#include <iosfwd>
 #include <memory_resource>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/mpsc_queue.h>
 
 namespace oxherdcpp
 {
+#ifdef OXHERDCPP_NO_POOL_STATS
+inline constexpr bool kPoolStatsEnabled{false};
+#else
+inline constexpr bool kPoolStatsEnabled{true};
+#endif
+
+// Threads that may count without read-modify-write instructions at a time; the rest share one more shard
+inline constexpr std::size_t kPoolCounterShards{32};
+
+// Allocation counters of one pool, split into cache-line sized shards so counting does not bounce a shared
+// cache line between cores. A thread leases a shard index for its lifetime and, being its only writer in
+// every pool, bumps it with a plain load and store; threads that find no free index share an overflow shard
+// with atomic adds. Reading sums the shards. Built with OXHERDCPP_NO_POOL_STATS, nothing is counted and
+// every counter reads zero.
+class PoolCounters
+{
+    DISABLE_COPY_AND_MOVE(PoolCounters)
+
+  public:
+    enum class Field : std::uint8_t
+    {
+        Allocations,
+        Deallocations,
+        BytesAllocated,
+        BytesDeallocated
+    };
+
+    PoolCounters() = default;
+
+    auto RecordAllocation([[maybe_unused]] const std::size_t bytes) noexcept -> void
+    {
+        if constexpr (kPoolStatsEnabled)
+        {
+            Record(Field::Allocations, Field::BytesAllocated, bytes);
+        }
+    }
+
+    auto RecordDeallocation([[maybe_unused]] const std::size_t bytes) noexcept -> void
+    {
+        if constexpr (kPoolStatsEnabled)
+        {
+            Record(Field::Deallocations, Field::BytesDeallocated, bytes);
+        }
+    }
+
+    [[nodiscard]] auto Sum(Field field) const noexcept -> std::size_t;
+
+  private:
+    struct alignas(kCacheLineSize) Shard
+    {
+        std::array<std::atomic<std::size_t>, 4> values{};
+    };
+
+    // Held by a thread until it exits
+    struct ShardLease
+    {
+        DISABLE_COPY_AND_MOVE(ShardLease)
+
+        ShardLease() noexcept;
+        ~ShardLease();
+
+        // kPoolCounterShards for the shared overflow shard
+        std::size_t index;
+    };
+
+    auto Record(const Field count_field, const Field bytes_field, const std::size_t bytes) noexcept -> void
+    {
+        thread_local ShardLease lease;
+        auto &values{shards_[lease.index].values};
+        auto &count{values[static_cast<std::size_t>(count_field)]};
+        auto &total_bytes{values[static_cast<std::size_t>(bytes_field)]};
+        if (lease.index == kPoolCounterShards)
+        {
+            count.fetch_add(1, std::memory_order_relaxed);
+            total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            return;
+        }
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        total_bytes.store(total_bytes.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+    }
+
+    std::array<Shard, kPoolCounterShards + 1> shards_{};
+};
+
+// One counter of a pool, summed when read. Reads like the std::atomic each counter used to be.
+class PoolCounter
+{
+  public:
+    PoolCounter(const PoolCounters &counters, PoolCounters::Field field) noexcept;
+
+    [[nodiscard]] auto load() const noexcept -> std::size_t; // NOLINT(readability-identifier-naming)
+
+  private:
+    const PoolCounters *counters_;
+    PoolCounters::Field field_;
+};
+
+// A live view of the counters of one pool
 struct PoolStats
 {
-    std::atomic<std::size_t> allocations{};
-    std::atomic<std::size_t> deallocations{};
-    std::atomic<std::size_t> bytes_allocated{};
-    std::atomic<std::size_t> bytes_deallocated{};
+    explicit PoolStats(const PoolCounters &counters) noexcept;
+
+    PoolCounter allocations;
+    PoolCounter deallocations;
+    PoolCounter bytes_allocated;
+    PoolCounter bytes_deallocated;
+};
+
+inline constexpr std::size_t kPoolThreadCacheCapacity{64};
+// Blocks moved between a thread cache and the shared free list at a time
+inline constexpr std::size_t kPoolTransferBatch{kPoolThreadCacheCapacity / 2};
+
+// Smallest slab a pool carves from upstream; slabs are aligned to their size, a power of two
+inline constexpr std::size_t kMinPoolChunkBytes{16 * 1024};
+inline constexpr std::size_t kMinBlocksPerChunk{8};
+
+// What a pool does when a new chunk would exceed its byte limit or the global one
+enum class PoolLimitAction : std::uint8_t
+{
+    // The block is allocated from upstream on its own, outside the thread caches, and returned to upstream
+    // as soon as it is freed
+    AllocateUnpooled,
+    Throw
+};
+
+struct PoolLimits
+{
+    // Bytes of chunks the pool may hold, zero for no limit
+    std::size_t max_bytes{0};
+    PoolLimitAction on_limit{PoolLimitAction::AllocateUnpooled};
+};
+
+// What one pool holds at the moment of a snapshot
+struct PoolReport
+{
+    std::string_view name;
+    std::size_t object_size{0};
+    std::size_t block_size{0};
+    // Objects allocated and not yet freed; zero when pool statistics are compiled out
+    std::size_t live_objects{0};
+    // Blocks out of the chunks, in use or sitting in thread caches
+    std::size_t blocks_out{0};
+    std::size_t unpooled_blocks{0};
+    std::size_t held_bytes{0};
+    // Highest held_bytes since the pool was created
+    std::size_t peak_held_bytes{0};
+    std::size_t reserved_bytes{0};
+};
+
+class CachedPool;
+struct PoolChunk;
+
+// Chunks linked through their headers
+struct PoolChunkList
+{
+    PoolChunk *head{nullptr};
 };
 
-class MonitoredPoolResource final : public std::pmr::synchronized_pool_resource
+// A free block, linked through its own storage
+struct PoolFreeBlock
 {
+    PoolFreeBlock *next;
+};
+
+// The blocks of one CachedPool that one thread may reuse without locking.
+class PoolThreadCache
+{
+    DISABLE_COPY_AND_MOVE(PoolThreadCache)
+
   public:
-    MonitoredPoolResource() = default;
+    explicit PoolThreadCache(CachedPool &pool) noexcept;
+
+    // Hands the cached blocks back to the pool when the thread exits
+    ~PoolThreadCache();
 
-    explicit MonitoredPoolResource(memory_resource *upstream);
+  private:
+    friend class CachedPool;
 
-    PoolStats &GetStats();
-    const PoolStats &GetStats() const;
+    // Null once destroyed: blocks freed later in the thread's teardown go straight to the pool
+    CachedPool *pool_;
+    PoolFreeBlock *head_{nullptr};
+    std::size_t size_{0};
+    std::uint64_t generation_;
+};
+
+// Fixed-size blocks with a lock-free fast path. Each thread allocates from and frees into its own
+// PoolThreadCache; a block freed on another thread than the one that allocated it simply joins the freeing
+// thread's cache. Caches exchange kPoolTransferBatch blocks at a time with the shared free lists, the only
+// part that takes a lock. Those are kept per chunk, a slab of blocks carved from the upstream resource, so a
+// chunk whose blocks are all back can be handed to upstream again by Trim.
+class CachedPool
+{
+    DISABLE_COPY_AND_MOVE(CachedPool)
+
+  public:
+    // name labels the pool in the inventory and must outlive it
+    CachedPool(std::size_t block_size, std::size_t alignment, std::string_view name = {},
+               std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
 
-  protected:
-    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void * override;
+    // Frees every chunk; no block may be in use
+    ~CachedPool();
 
-    auto do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) -> void override;
+    auto Allocate(PoolThreadCache &cache) -> void *
+    {
+        if (!IsUsable(cache))
+        {
+            return AllocateShared();
+        }
+        if (cache.head_ == nullptr && !Refill(cache))
+        {
+            return AllocateShared();
+        }
+        auto *const block{cache.head_};
+        cache.head_ = block->next;
+        --cache.size_;
+        counters_.RecordAllocation(block_size_);
+        return block;
+    }
+
+    auto Deallocate(PoolThreadCache &cache, void *ptr) noexcept -> void
+    {
+        if (unpooled_count_.load(std::memory_order_relaxed) != 0 && DeallocateUnpooled(ptr))
+        {
+            return;
+        }
+        if (!IsUsable(cache))
+        {
+            DeallocateShared(ptr);
+            return;
+        }
+        if (cache.size_ >= kPoolThreadCacheCapacity)
+        {
+            Drain(cache, kPoolTransferBatch);
+        }
+        cache.head_ = ::new (ptr) PoolFreeBlock{cache.head_};
+        ++cache.size_;
+        counters_.RecordDeallocation(block_size_);
+    }
+
+    [[nodiscard]] auto GetStats() const -> const PoolStats &;
+
+    // Carves chunks up front until the pool holds at least block_count blocks, and keeps that many from
+    // being trimmed. Returns false when the limits stopped it short.
+    auto Reserve(std::size_t block_count) -> bool;
+
+    auto SetLimits(PoolLimits limits) -> void;
+
+    [[nodiscard]] auto GetLimits() const -> PoolLimits;
+
+    // Returns chunks with no block in use or in a thread cache to upstream, down to the reserved size.
+    // Returns the bytes freed.
+    auto Trim() -> std::size_t;
+
+    // Bytes of chunks currently held from upstream, unpooled blocks aside
+    [[nodiscard]] auto GetHeldBytes() const -> std::size_t;
+
+    [[nodiscard]] auto GetReport() const -> PoolReport;
+
+    // Frees every block, cached or not; no block may be in use. Caches of other threads drop their blocks
+    // the next time those threads use the pool.
+    auto Release() -> void;
 
   private:
-    PoolStats stats_;
+    friend class PoolThreadCache;
+
+    // A cache from before the last Release forgets its blocks, they were freed with the rest
+    auto IsUsable(PoolThreadCache &cache) const noexcept -> bool
+    {
+        if (cache.pool_ == nullptr)
+        {
+            return false;
+        }
+        if (const auto generation{generation_.load(std::memory_order_acquire)}; cache.generation_ != generation)
+        {
+            cache.head_ = nullptr;
+            cache.size_ = 0;
+            cache.generation_ = generation;
+        }
+        return true;
+    }
+
+    // False when the limits left no pooled block to take. Throws std::bad_alloc only when upstream failed
+    // before even one block was obtained.
+    auto Refill(PoolThreadCache &cache) -> bool;
+
+    // Moves count blocks from the cache to the shared free list
+    auto Drain(PoolThreadCache &cache, std::size_t count) noexcept -> void;
+
+    // Past the limits serves an unpooled block, one at a time so none of them lands in a thread cache
+    auto AllocateShared() -> void *;
+
+    auto DeallocateShared(void *ptr) noexcept -> void;
+
+    // Returns an unpooled block to upstream; false when ptr is a pooled block
+    auto DeallocateUnpooled(void *ptr) noexcept -> bool;
+
+    // The rest need mutex_ held
+
+    // Prefers partly used chunks, so that empty ones stay empty for Trim. Null when the limits forbid a new
+    // chunk.
+    auto TakeShared() -> void *;
+
+    auto PutShared(void *ptr) noexcept -> void;
+
+    // Null when the limits forbid a new chunk
+    auto CarveChunk() -> PoolChunk *;
+
+    auto FreeUnpooledBlocks() noexcept -> void;
+
+    auto FreeChunk(PoolChunk *chunk) noexcept -> void;
+
+    auto FreeChunks(PoolChunkList &chunks) noexcept -> void;
+
+    [[nodiscard]] auto GetChunk(void *block) const noexcept -> PoolChunk *;
+
+    std::string_view name_;
+    std::size_t object_size_;
+    std::size_t alignment_;
+    std::size_t block_size_;
+    std::size_t chunk_size_;
+    // Offset of the first block past the chunk header
+    std::size_t first_block_offset_;
+    std::size_t blocks_per_chunk_;
+    std::atomic<std::uint64_t> generation_{0};
+    PoolCounters counters_;
+    PoolStats stats_{counters_};
+
+    mutable std::mutex mutex_;
+    std::pmr::memory_resource *upstream_;
+    PoolLimits limits_{};
+    std::size_t held_bytes_{0};
+    std::size_t peak_held_bytes_{0};
+    std::size_t reserved_bytes_{0};
+    std::size_t blocks_out_{0};
+    // Blocks allocated past the limits, each on its own and aligned like a pooled block
+    std::unordered_set<void *> unpooled_blocks_{};
+    // Size of unpooled_blocks_, readable without the lock so freeing pooled blocks skips the lookup
+    std::atomic<std::size_t> unpooled_count_{0};
+    // Chunks with some but not all blocks free, chunks with every block free, chunks with none free
+    PoolChunkList partial_chunks_{};
+    PoolChunkList empty_chunks_{};
+    PoolChunkList full_chunks_{};
 };
+
+// Caps the bytes held by all message pools together; zero for no limit. A pool that would exceed it acts
+// as its own limit says.
+auto SetGlobalPoolLimit(std::size_t max_bytes) -> void;
+
+[[nodiscard]] auto GetGlobalPoolLimit() -> std::size_t;
+
+// Bytes of chunks held by all pools together
+[[nodiscard]] auto GetGlobalPoolBytes() -> std::size_t;
+
+// Trims every pool alive, see CachedPool::Trim. Returns the bytes freed.
+auto TrimAllPools() -> std::size_t;
+
+// Reports of every pool alive, each pool locked only while its own report is taken
+[[nodiscard]] auto GetPoolInventory() -> std::vector<PoolReport>;
+
+// One line per pool, the pools holding most memory first
+auto WritePoolInventory(std::ostream &out) -> void;
 } // namespace oxherdcpp
\ No newline at end of file
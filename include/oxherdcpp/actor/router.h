@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/message/message.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+#include <oxherdcpp/common/mpsc_queue.h>
+
+namespace oxherdcpp
+{
+
+class ActorContext;
+class ActorSystemFacade;
+
+enum class RoutingStrategy
+{
+    RoundRobin,
+    Random,
+    // Messages with equal keys reach the same routee, see RouterConfig::hash_key
+    ConsistentHash,
+    // The routee with the fewest queued messages, an idle one on ties
+    SmallestMailbox
+};
+
+inline constexpr std::size_t kDefaultVirtualNodes{64};
+
+// Maps a message to its key for RoutingStrategy::ConsistentHash.
+using HashKeyExtractor = std::function<std::size_t(const BaseMessage &)>;
+
+// Spawns routee number index as a child of the router, typically with ActorContext::SpawnChild. The
+// supervision strategy passed there decides what happens to the routee when it fails.
+using RouteeFactory = std::function<ActorRef(ActorContext &context, std::size_t index)>;
+
+struct RouteResult
+{
+    bool accepted{false};
+    // Handed back when no routee is alive.
+    MPtr<BaseMessage> unrouted{};
+};
+
+struct RouterConfig
+{
+    RoutingStrategy strategy{RoutingStrategy::RoundRobin};
+    std::size_t routee_count{1};
+    // Required by ConsistentHash.
+    HashKeyExtractor hash_key{};
+    // Points per routee on the consistent hash ring.
+    std::size_t virtual_nodes{kDefaultVirtualNodes};
+};
+
+// The routee table of a router, shared with every Router handle. Routing runs on the sender's thread; the
+// table is replaced as a whole when a routee restarts or stops, so senders never wait for the router.
+class RoutingLogic
+{
+    DISABLE_COPY_AND_MOVE(RoutingLogic)
+
+  public:
+    // Throws std::invalid_argument when there are no routees or ConsistentHash has no hash_key.
+    explicit RoutingLogic(RouterConfig config);
+
+    // Not accepted when no routee is alive or the chosen routee's mailbox refused the message.
+    auto Route(MPtr<BaseMessage> message) -> RouteResult;
+
+    // A null routee takes the slot out of routing.
+    auto SetRoutee(std::size_t index, Sptr<Actor> routee) -> void;
+
+    [[nodiscard]] auto FindRoutee(ActorId routee_id) const -> std::optional<std::size_t>;
+
+    // Routees currently taking messages.
+    [[nodiscard]] auto GetRouteeCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetConfig() const -> const RouterConfig &;
+
+  private:
+    using Routees = std::vector<Sptr<Actor>>;
+
+    [[nodiscard]] auto Select(const Routees &routees, const BaseMessage &message) -> Actor *;
+
+    // The first live routee from start on, wrapping around
+    [[nodiscard]] static auto SelectFrom(const Routees &routees, std::size_t start) -> Actor *;
+
+    [[nodiscard]] static auto SelectSmallestMailbox(const Routees &routees) -> Actor *;
+
+    [[nodiscard]] auto SelectConsistentHash(const Routees &routees, const BaseMessage &message) const -> Actor *;
+
+    RouterConfig config_;
+    // Sorted (point, routee index) pairs
+    std::vector<std::pair<std::size_t, std::size_t>> ring_;
+    std::atomic<Sptr<const Routees>> routees_;
+    alignas(kCacheLineSize) std::atomic<std::size_t> next_{0};
+};
+
+// What senders hold instead of an ActorRef to the router: messages go straight to a routee's mailbox,
+// without a hop through the router's own. Messages without a live routee become dead letters.
+class Router
+{
+  public:
+    Router(Sptr<RoutingLogic> logic, ActorId router_id, Wptr<ActorSystemFacade> system_facade);
+
+    auto Tell(MPtr<BaseMessage> message) noexcept -> void;
+
+    auto TryTell(MPtr<BaseMessage> message) noexcept -> bool;
+
+    [[nodiscard]] auto GetRouteeCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetId() const noexcept -> ActorId;
+
+  private:
+    Sptr<RoutingLogic> logic_;
+    ActorId router_id_;
+    Wptr<ActorSystemFacade> system_facade_;
+};
+
+// Owns a pool of routees, spawned as its children when it starts. Failed routees are handled by their
+// supervision strategy; restarted ones take over their slot, stopped ones leave routing. User messages sent
+// to the router actor itself are routed as well.
+class RouterActor final : public Actor
+{
+  public:
+    RouterActor(const Executor &executor, const std::string &name, ActorId actor_id, RouterConfig config,
+                RouteeFactory factory);
+
+    // Routes nothing until the router has started.
+    [[nodiscard]] auto GetRouter() -> Router;
+
+  protected:
+    auto OnInitialize() -> void override;
+
+  private:
+    auto Behaviour(const MPtr<BaseMessage> &message) -> void override;
+
+    auto HandleRouteeFailure(const MPtr<ActorFailureEvent> &failure_event) -> void;
+
+    RouteeFactory factory_;
+    Sptr<RoutingLogic> logic_;
+};
+
+} // namespace oxherdcpp
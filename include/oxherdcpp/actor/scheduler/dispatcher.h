@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <oxherdcpp/actor/scheduler/thread_affinity.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+
+namespace oxherdcpp
+{
+
+// The system's own scheduler, whatever SchedulerKind it is.
+inline constexpr std::string_view kDefaultDispatcher{"default"};
+// Separate pool for actors that call blocking code, registered by every ActorSystem.
+inline constexpr std::string_view kBlockingDispatcher{"blocking"};
+
+inline constexpr std::size_t kDefaultBlockingThreadCount{8};
+
+enum class DispatcherKind
+{
+    // A pool of thread_count threads shared by all actors of the dispatcher.
+    ThreadPool,
+    // Every actor gets a thread of its own, thread_count is ignored.
+    PinnedThread
+};
+
+struct DispatcherConfig
+{
+    std::string name{};
+    DispatcherKind kind{DispatcherKind::ThreadPool};
+    std::size_t thread_count{1};
+    WorkerAffinity affinity{};
+};
+
+// Runs actors outside the system scheduler so they cannot stall it. Threads are started on first use
+// and live until Stop. A pinned thread goes back to the dispatcher once its actor is gone and is handed to
+// the next pinned actor, so churning actors does not pile up threads.
+class Dispatcher
+{
+    DISABLE_COPY_AND_MOVE(Dispatcher)
+
+    using WorkGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+    struct Lane
+    {
+        explicit Lane(const int concurrency_hint) : context{concurrency_hint}, work_guard{context.get_executor()}
+        {
+        }
+
+        boost::asio::io_context context;
+        std::optional<WorkGuard> work_guard;
+        std::vector<std::jthread> threads{};
+        // A pinned lane serves one actor at a time
+        std::atomic<bool> is_leased{false};
+    };
+
+    // Shared by the copies of a pinned actor's executor, frees the lane with the last of them
+    struct LaneLease
+    {
+        DISABLE_COPY_AND_MOVE(LaneLease)
+
+        explicit LaneLease(Sptr<Lane> lane) noexcept : lane{std::move(lane)}
+        {
+        }
+
+        ~LaneLease()
+        {
+            lane->is_leased.store(false, std::memory_order_release);
+        }
+
+        Sptr<Lane> lane;
+    };
+
+  public:
+    // Executor of a pinned actor. Runs work on the lane's io_context and keeps the lane leased while copied.
+    class LaneExecutor
+    {
+      public:
+        explicit LaneExecutor(Sptr<LaneLease> lease, const bool is_continuation = false) noexcept
+            : lease_{std::move(lease)}, is_continuation_{is_continuation}
+        {
+        }
+
+        [[nodiscard]] auto query(boost::asio::execution::context_t) const noexcept -> boost::asio::io_context &
+        {
+            return lease_->lane->context;
+        }
+
+        static constexpr auto query(boost::asio::execution::blocking_t) noexcept
+            -> boost::asio::execution::blocking_t
+        {
+            return boost::asio::execution::blocking.never;
+        }
+
+        [[nodiscard]] auto query(boost::asio::execution::relationship_t) const noexcept
+            -> boost::asio::execution::relationship_t
+        {
+            if (is_continuation_)
+            {
+                return boost::asio::execution::relationship.continuation;
+            }
+            return boost::asio::execution::relationship.fork;
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::blocking_t::never_t) const noexcept -> LaneExecutor
+        {
+            return *this;
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::relationship_t::fork_t) const noexcept -> LaneExecutor
+        {
+            return LaneExecutor{lease_, false};
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::relationship_t::continuation_t) const noexcept
+            -> LaneExecutor
+        {
+            return LaneExecutor{lease_, true};
+        }
+
+        template <typename Function> auto execute(Function &&function) const -> void
+        {
+            if (is_continuation_)
+            {
+                boost::asio::defer(lease_->lane->context, std::forward<Function>(function));
+                return;
+            }
+            boost::asio::post(lease_->lane->context, std::forward<Function>(function));
+        }
+
+        friend auto operator==(const LaneExecutor &lhs, const LaneExecutor &rhs) noexcept -> bool
+        {
+            return lhs.lease_ == rhs.lease_ && lhs.is_continuation_ == rhs.is_continuation_;
+        }
+
+        friend auto operator!=(const LaneExecutor &lhs, const LaneExecutor &rhs) noexcept -> bool
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        Sptr<LaneLease> lease_;
+        bool is_continuation_;
+    };
+
+    explicit Dispatcher(DispatcherConfig config);
+
+    ~Dispatcher();
+
+    // Executor for a new actor of this dispatcher.
+    auto AcquireExecutor() -> boost::asio::any_io_executor;
+
+    [[nodiscard]] auto GetConfig() const -> const DispatcherConfig &;
+
+    // Threads started so far; a recycled pinned thread is counted once.
+    [[nodiscard]] auto GetThreadCount() const -> std::size_t;
+
+    // Lets the threads run out of work and joins them.
+    auto Stop() -> void;
+
+  private:
+    auto StartLane(std::size_t thread_count) -> Sptr<Lane>;
+
+    // Leases an idle pinned lane or starts a new one
+    auto LeaseLane() -> Sptr<Lane>;
+
+    DispatcherConfig config_;
+    mutable std::mutex mutex_;
+    std::vector<Sptr<Lane>> lanes_;
+    std::size_t thread_count_{0};
+    bool is_stopped_{false};
+};
+
+} // namespace oxherdcpp
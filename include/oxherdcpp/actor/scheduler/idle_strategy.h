@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <boost/asio.hpp>
+
+#include <oxherdcpp/common/helper_macros.h>
+
+namespace oxherdcpp
+{
+
+inline constexpr std::size_t kDefaultIdleSpinCount{1024};
+inline constexpr std::size_t kDefaultIdleYieldCount{64};
+
+// What a worker thread does when it runs out of work.
+enum class IdleStrategyKind
+{
+    // Parks right away; the next task pays for a futex wake-up.
+    Block,
+    // Polls spin_count more times with a CPU pause hint between polls, then parks.
+    Spin,
+    // Polls spin_count times with a pause hint, then yield_count times with std::this_thread::yield, then parks.
+    SpinYieldPark,
+    // Never parks and keeps its core busy. Meant for latency-critical deployments with cores to spare.
+    BusyPoll
+};
+
+struct IdleStrategy
+{
+    IdleStrategyKind kind{IdleStrategyKind::Block};
+    std::size_t spin_count{kDefaultIdleSpinCount};
+    std::size_t yield_count{kDefaultIdleYieldCount};
+};
+
+struct IdleStats
+{
+    // Times a worker ran out of work and found some again before parking.
+    std::size_t wakeups_avoided{0};
+    // Times a worker ran out of work and parked.
+    std::size_t parks{0};
+};
+
+// Shared by all workers of a runtime. Only idle transitions are counted, never individual polls.
+struct IdleCounters
+{
+    [[nodiscard]] auto GetStats() const -> IdleStats
+    {
+        return IdleStats{.wakeups_avoided = wakeups_avoided.load(std::memory_order_relaxed),
+                         .parks = parks.load(std::memory_order_relaxed)};
+    }
+
+    std::atomic<std::size_t> wakeups_avoided{0};
+    std::atomic<std::size_t> parks{0};
+};
+
+// Backoff state of one worker thread.
+class IdleBackoff
+{
+    DISABLE_COPY_AND_MOVE(IdleBackoff)
+
+  public:
+    IdleBackoff(const IdleStrategy &strategy, IdleCounters &counters);
+
+    // The worker polled and found nothing. Waits one step of the strategy and returns true once the worker
+    // should park instead of polling again.
+    auto Idle() -> bool;
+
+    // The worker found work.
+    auto Busy() -> void
+    {
+        if (idle_polls_ != 0)
+        {
+            idle_polls_ = 0;
+            counters_.wakeups_avoided.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    IdleStrategy strategy_;
+    IdleCounters &counters_;
+    std::size_t idle_polls_{0};
+};
+
+// Runs the io_context until it stops, like io_context::run, but goes through the idle strategy before
+// blocking. Block calls io_context::run directly and leaves the counters alone.
+auto RunIoContext(boost::asio::io_context &context, const IdleStrategy &strategy, IdleCounters &counters) -> void;
+
+} // namespace oxherdcpp
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace oxherdcpp
+{
+
+// Type-erased handler owned by a scheduler queue. Queues store raw pointers so they can be lock-free;
+// whoever pops a task runs and deletes it.
+class SchedulerTask
+{
+  public:
+    virtual ~SchedulerTask() = default;
+    virtual auto Run() -> void = 0;
+};
+
+template <typename Function> class FunctionTask final : public SchedulerTask
+{
+  public:
+    explicit FunctionTask(Function function) : function_{std::move(function)}
+    {
+    }
+
+    auto Run() -> void override
+    {
+        function_();
+    }
+
+  private:
+    Function function_;
+};
+
+template <typename Function> [[nodiscard]] auto MakeSchedulerTask(Function &&function) -> SchedulerTask *
+{
+    using Decayed = std::decay_t<Function>;
+    return new FunctionTask<Decayed>{Decayed{std::forward<Function>(function)}};
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <oxherdcpp/actor/scheduler/idle_strategy.h>
+#include <oxherdcpp/actor/scheduler/scheduler_task.h>
+#include <oxherdcpp/actor/scheduler/thread_affinity.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+#include <oxherdcpp/common/spsc_ring.h>
+
+namespace oxherdcpp
+{
+
+// Thread-per-core runtime: every shard owns a single-threaded io_context and one thread running it.
+// Work submitted from the shard's own thread stays there. Work coming from another shard goes through the
+// ring dedicated to that (source, destination) pair and a single drain handler per batch, so shards never
+// contend on each other's io_context queue. Foreign threads post to the io_context directly.
+class ShardedRuntime
+{
+    DISABLE_COPY_AND_MOVE(ShardedRuntime)
+
+    static constexpr std::size_t kRingCapacity{256};
+    using Ring = SpscRing<SchedulerTask *, kRingCapacity>;
+    using WorkGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+    struct Shard
+    {
+        explicit Shard(const std::size_t shard_count) : context{1}, inbound(shard_count)
+        {
+        }
+
+        boost::asio::io_context context;
+        std::optional<WorkGuard> work_guard{};
+        std::atomic<bool> drain_pending{false};
+        // Indexed by source shard, the slot of the shard itself stays empty
+        std::vector<Uptr<Ring>> inbound;
+    };
+
+  public:
+    class executor_type
+    {
+      public:
+        executor_type(ShardedRuntime &runtime, const std::size_t shard, const bool is_continuation = false) noexcept
+            : runtime_{&runtime}, shard_{shard}, is_continuation_{is_continuation}
+        {
+        }
+
+        [[nodiscard]] auto query(boost::asio::execution::context_t) const noexcept -> boost::asio::io_context &
+        {
+            return runtime_->shards_[shard_]->context;
+        }
+
+        static constexpr auto query(boost::asio::execution::blocking_t) noexcept
+            -> boost::asio::execution::blocking_t
+        {
+            return boost::asio::execution::blocking.never;
+        }
+
+        [[nodiscard]] auto query(boost::asio::execution::relationship_t) const noexcept
+            -> boost::asio::execution::relationship_t
+        {
+            if (is_continuation_)
+            {
+                return boost::asio::execution::relationship.continuation;
+            }
+            return boost::asio::execution::relationship.fork;
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::blocking_t::never_t) const noexcept -> executor_type
+        {
+            return *this;
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::relationship_t::fork_t) const noexcept -> executor_type
+        {
+            return executor_type{*runtime_, shard_, false};
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::relationship_t::continuation_t) const noexcept
+            -> executor_type
+        {
+            return executor_type{*runtime_, shard_, true};
+        }
+
+        template <typename Function> auto execute(Function &&function) const -> void
+        {
+            runtime_->Execute(shard_, is_continuation_, std::forward<Function>(function));
+        }
+
+        [[nodiscard]] auto GetShard() const noexcept -> std::size_t
+        {
+            return shard_;
+        }
+
+        friend auto operator==(const executor_type &lhs, const executor_type &rhs) noexcept -> bool
+        {
+            return lhs.runtime_ == rhs.runtime_ && lhs.shard_ == rhs.shard_ &&
+                   lhs.is_continuation_ == rhs.is_continuation_;
+        }
+
+        friend auto operator!=(const executor_type &lhs, const executor_type &rhs) noexcept -> bool
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        ShardedRuntime *runtime_;
+        std::size_t shard_;
+        bool is_continuation_;
+    };
+
+    // shard_cpus[i] is the CPU set the thread of shard i pins itself to; missing or empty entries leave it unpinned.
+    explicit ShardedRuntime(std::size_t shard_count, std::vector<CpuSet> shard_cpus = {},
+                            IdleStrategy idle_strategy = {});
+
+    ~ShardedRuntime();
+
+    auto GetExecutor(std::size_t shard) -> executor_type;
+
+    [[nodiscard]] auto GetShardCount() const -> std::size_t;
+
+    // Shard whose thread is the caller, empty for threads that do not belong to this runtime.
+    [[nodiscard]] auto GetCurrentShard() const -> std::optional<std::size_t>;
+
+    // Number of tasks handed from one shard to another through the rings.
+    [[nodiscard]] auto GetCrossShardCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetIdleStats() const -> IdleStats;
+
+    // Lets every shard run out of work and joins the threads.
+    auto Stop() -> void;
+
+  private:
+    template <typename Function>
+    auto Execute(const std::size_t shard, const bool is_continuation, Function &&function) -> void
+    {
+        const auto source{GetCurrentShard()};
+        if (!source || *source == shard)
+        {
+            ExecuteLocal(shard, is_continuation, std::forward<Function>(function));
+            return;
+        }
+        auto *task{MakeSchedulerTask(std::forward<Function>(function))};
+        if (!shards_[shard]->inbound[*source]->TryPush(task))
+        {
+            // The ring is full, the destination is far behind anyway
+            ExecuteLocal(shard, false, [task] {
+                const Uptr<SchedulerTask> owned{task};
+                owned->Run();
+            });
+            return;
+        }
+        cross_shard_count_.fetch_add(1, std::memory_order_relaxed);
+        WakeShard(shard);
+    }
+
+    template <typename Function>
+    auto ExecuteLocal(const std::size_t shard, const bool is_continuation, Function &&function) -> void
+    {
+        const auto executor{
+            boost::asio::require(shards_[shard]->context.get_executor(), boost::asio::execution::blocking.never)};
+        if (is_continuation)
+        {
+            boost::asio::require(executor, boost::asio::execution::relationship.continuation)
+                .execute(std::forward<Function>(function));
+        }
+        else
+        {
+            executor.execute(std::forward<Function>(function));
+        }
+    }
+
+    auto WakeShard(std::size_t shard) -> void;
+
+    auto Drain(std::size_t shard) -> void;
+
+    auto DestroyPendingTasks() -> void;
+
+    std::vector<Uptr<Shard>> shards_;
+    std::vector<std::jthread> threads_;
+    std::atomic<bool> is_running_{false};
+    std::atomic<std::size_t> cross_shard_count_{0};
+    IdleStrategy idle_strategy_;
+    IdleCounters idle_counters_;
+};
+
+} // namespace oxherdcpp
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace oxherdcpp
+{
+
+// Logical CPU numbers as the kernel reports them.
+using CpuSet = std::vector<std::size_t>;
+
+struct NumaNode
+{
+    std::size_t id{0};
+    CpuSet cpus{};
+};
+
+enum class WorkerPinning
+{
+    // Placement is left to the OS scheduler.
+    None,
+    // Worker i runs on cpu_sets[i % cpu_sets.size()].
+    Explicit,
+    // Every worker gets a CPU of its own, taken node by node so neighbouring workers share a node.
+    PerCpu,
+    // Workers are split into contiguous groups, one per NUMA node, and may run on any CPU of their node.
+    PerNumaNode
+};
+
+struct WorkerAffinity
+{
+    WorkerPinning pinning{WorkerPinning::None};
+    // Used by WorkerPinning::Explicit.
+    std::vector<CpuSet> cpu_sets{};
+};
+
+// Parses the kernel cpulist format, e.g. "0-3,8,10-11". Malformed parts are skipped.
+[[nodiscard]] auto ParseCpuList(std::string_view list) -> CpuSet;
+
+// NUMA nodes of the machine limited to the CPUs the process may run on; nodes left without CPUs are omitted.
+// A single node holding every allowed CPU when the topology is unknown.
+[[nodiscard]] auto GetNumaNodes() -> std::vector<NumaNode>;
+
+// Keeps only the allowed CPUs of every node and drops the nodes left empty. allowed must be sorted.
+[[nodiscard]] auto RestrictNumaNodes(std::vector<NumaNode> nodes, const CpuSet &allowed) -> std::vector<NumaNode>;
+
+// CPU set of every worker; an empty set means the worker stays unpinned.
+[[nodiscard]] auto ResolveWorkerCpuSets(const WorkerAffinity &affinity, std::size_t worker_count,
+                                        const std::vector<NumaNode> &nodes) -> std::vector<CpuSet>;
+
+[[nodiscard]] auto ResolveWorkerCpuSets(const WorkerAffinity &affinity, std::size_t worker_count)
+    -> std::vector<CpuSet>;
+
+// Restricts the calling thread to the given CPUs. Returns false when the platform or the kernel refuses.
+// Memory the thread touches first afterwards is then allocated on its node by the kernel's first-touch policy.
+auto PinCurrentThread(const CpuSet &cpus) -> bool;
+
+// Pins a runtime worker at thread start, logging a warning when that fails. Does nothing for an empty set.
+auto PinWorkerThread(std::size_t worker, const CpuSet &cpus) -> void;
+
+[[nodiscard]] auto GetCurrentThreadAffinity() -> CpuSet;
+
+} // namespace oxherdcpp
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace oxherdcpp
+{
+
+// Identifies a scheduled timer. A default constructed handle refers to no timer.
+struct TimerHandle
+{
+    std::uint32_t index{0};
+    std::uint32_t generation{0};
+
+    explicit operator bool() const noexcept
+    {
+        return generation != 0;
+    }
+
+    friend auto operator==(const TimerHandle &, const TimerHandle &) -> bool = default;
+};
+
+} // namespace oxherdcpp
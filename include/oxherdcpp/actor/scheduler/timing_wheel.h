@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/message/message.h>
+#include <oxherdcpp/actor/scheduler/timer_handle.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+
+namespace oxherdcpp
+{
+
+inline constexpr std::chrono::milliseconds kDefaultTimerTick{1};
+
+// Hierarchical timing wheel delivering messages to actors after a delay, driven by one tick thread that
+// starts on the first scheduled timer. Four levels of 256 slots cover 2^32 ticks; longer delays are
+// clamped. Insert and cancel unlink a node from an intrusive slot list, so both are O(1) whatever the
+// number of outstanding timers. Timer nodes live in chunks that are recycled, not freed.
+class TimingWheel
+{
+    DISABLE_COPY_AND_MOVE(TimingWheel)
+
+    static constexpr std::size_t kSlotBits{8};
+    static constexpr std::size_t kSlotCount{std::size_t{1} << kSlotBits};
+    static constexpr std::size_t kLevelCount{4};
+    static constexpr std::uint64_t kMaxTicks{(std::uint64_t{1} << (kSlotBits * kLevelCount)) - 1};
+    static constexpr std::size_t kChunkSize{4096};
+    static constexpr std::uint32_t kNil{UINT32_MAX};
+
+    struct Node
+    {
+        std::uint32_t prev{kNil};
+        std::uint32_t next{kNil};
+        std::uint32_t generation{1};
+        // level * kSlotCount + slot of the list the node is linked into
+        std::uint32_t slot{0};
+        bool is_scheduled{false};
+        std::uint64_t deadline{0};
+        std::uint64_t period{0};
+        ActorRef target{ActorId{}, {}};
+        MPtr<BaseMessage> message{};
+        // Runs instead of a delivery when set
+        std::function<void()> callback{};
+    };
+
+    struct Due
+    {
+        ActorRef target;
+        MPtr<BaseMessage> message;
+        std::function<void()> callback;
+    };
+
+    struct Slot
+    {
+        std::uint32_t head{kNil};
+    };
+
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = Clock::duration;
+
+    explicit TimingWheel(Duration tick = kDefaultTimerTick);
+
+    ~TimingWheel();
+
+    auto ScheduleOnce(Duration delay, ActorRef target, MPtr<BaseMessage> message) -> TimerHandle;
+
+    // Sends the same message every interval after the initial delay. Deadlines advance by the interval
+    // rather than from the delivery time, so a late tick does not shift the following ones.
+    auto ScheduleAtFixedRate(Duration initial_delay, Duration interval, ActorRef target, MPtr<BaseMessage> message)
+        -> TimerHandle;
+
+    // Runs the callback on the tick thread after the delay. The callback must not block.
+    auto ScheduleCallback(Duration delay, std::function<void()> callback) -> TimerHandle;
+
+    // False when the timer already fired (one-shot), was cancelled or never existed. A message collected
+    // for delivery just before the call is still delivered.
+    auto Cancel(TimerHandle handle) -> bool;
+
+    [[nodiscard]] auto GetTimerCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetTick() const -> Duration;
+
+    // Joins the tick thread and drops every pending timer.
+    auto Stop() -> void;
+
+  private:
+    auto Schedule(Duration delay, Duration interval, ActorRef target, MPtr<BaseMessage> message,
+                  std::function<void()> callback = {}) -> TimerHandle;
+
+    [[nodiscard]] auto ToTicks(Duration duration) const -> std::uint64_t;
+
+    [[nodiscard]] auto GetNode(std::uint32_t index) -> Node &;
+
+    auto AllocateNode() -> std::uint32_t;
+
+    auto ReleaseNode(std::uint32_t index) -> void;
+
+    auto Link(std::uint32_t index) -> void;
+
+    auto Unlink(std::uint32_t index) -> void;
+
+    // Moves the wheel one tick forward and collects the messages due at the new tick.
+    auto Advance() -> void;
+
+    auto Cascade(std::size_t level) -> void;
+
+    auto TickLoop(const std::stop_token &stop_token) -> void;
+
+    const Duration tick_;
+    const Clock::time_point start_{Clock::now()};
+
+    mutable std::mutex mutex_;
+    std::condition_variable_any timers_added_;
+    std::array<Slot, kSlotCount * kLevelCount> slots_{};
+    std::vector<Uptr<Node[]>> chunks_;
+    std::uint32_t free_head_{kNil};
+    std::uint32_t node_count_{0};
+    std::size_t timer_count_{0};
+    std::uint64_t current_tick_{0};
+    std::vector<Due> due_;
+    bool is_stopped_{false};
+    std::jthread thread_;
+};
+
+} // namespace oxherdcpp
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <oxherdcpp/actor/scheduler/idle_strategy.h>
+#include <oxherdcpp/actor/scheduler/scheduler_task.h>
+#include <oxherdcpp/actor/scheduler/thread_affinity.h>
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/memory.h>
+
+namespace oxherdcpp
+{
+
+// Thread pool with a run queue per worker instead of one shared queue.
+// Work submitted from a worker goes to that worker: a fork (asio::post) lands in the LIFO slot so a freshly
+// woken actor runs next while its messages are still hot in cache, a continuation (asio::defer) goes to the
+// back of the local queue. Work from foreign threads and local overflow go to a shared injection queue.
+// Idle workers steal half of a random victim's local queue, then follow the idle strategy before parking.
+class WorkStealingScheduler final : public boost::asio::execution_context
+{
+    DISABLE_COPY_AND_MOVE(WorkStealingScheduler)
+
+    using Task = SchedulerTask;
+
+    struct Worker;
+
+  public:
+    class executor_type
+    {
+      public:
+        explicit executor_type(WorkStealingScheduler &scheduler, const bool is_continuation = false) noexcept
+            : scheduler_{&scheduler}, is_continuation_{is_continuation}
+        {
+        }
+
+        [[nodiscard]] auto query(boost::asio::execution::context_t) const noexcept -> WorkStealingScheduler &
+        {
+            return *scheduler_;
+        }
+
+        static constexpr auto query(boost::asio::execution::blocking_t) noexcept
+            -> boost::asio::execution::blocking_t
+        {
+            return boost::asio::execution::blocking.never;
+        }
+
+        [[nodiscard]] auto query(boost::asio::execution::relationship_t) const noexcept
+            -> boost::asio::execution::relationship_t
+        {
+            if (is_continuation_)
+            {
+                return boost::asio::execution::relationship.continuation;
+            }
+            return boost::asio::execution::relationship.fork;
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::blocking_t::never_t) const noexcept -> executor_type
+        {
+            return *this;
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::relationship_t::fork_t) const noexcept -> executor_type
+        {
+            return executor_type{*scheduler_, false};
+        }
+
+        [[nodiscard]] auto require(boost::asio::execution::relationship_t::continuation_t) const noexcept
+            -> executor_type
+        {
+            return executor_type{*scheduler_, true};
+        }
+
+        template <typename Function> auto execute(Function &&function) const -> void
+        {
+            scheduler_->Submit(MakeSchedulerTask(std::forward<Function>(function)), is_continuation_);
+        }
+
+        friend auto operator==(const executor_type &lhs, const executor_type &rhs) noexcept -> bool
+        {
+            return lhs.scheduler_ == rhs.scheduler_ && lhs.is_continuation_ == rhs.is_continuation_;
+        }
+
+        friend auto operator!=(const executor_type &lhs, const executor_type &rhs) noexcept -> bool
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        WorkStealingScheduler *scheduler_;
+        bool is_continuation_;
+    };
+
+    // worker_cpus[i] is the CPU set worker i pins itself to; missing or empty entries leave it unpinned.
+    explicit WorkStealingScheduler(std::size_t thread_count, std::vector<CpuSet> worker_cpus = {},
+                                   IdleStrategy idle_strategy = {});
+
+    ~WorkStealingScheduler();
+
+    auto get_executor() noexcept -> executor_type;
+
+    // Lets the workers drain the queued tasks and joins them. Tasks submitted after that are destroyed
+    // without running.
+    auto Stop() -> void;
+
+    [[nodiscard]] auto GetThreadCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetStealCount() const -> std::size_t;
+
+    [[nodiscard]] auto GetIdleStats() const -> IdleStats;
+
+    // True when called from one of this scheduler's workers.
+    [[nodiscard]] auto RunningInThisThread() const -> bool;
+
+  private:
+    auto Submit(Task *task, bool is_continuation) -> void;
+
+    auto PushLocal(Worker &worker, Task *task) -> void;
+
+    auto PushInjected(Task *task) -> void;
+
+    auto PopInjected() -> Task *;
+
+    auto Steal(Worker &thief) -> Task *;
+
+    auto FindTask(Worker &worker) -> Task *;
+
+    auto HasPendingWork() const -> bool;
+
+    auto NotifyIdleWorker() -> void;
+
+    auto Park(Worker &worker) -> void;
+
+    auto WorkerLoop(Worker &worker) -> void;
+
+    auto DestroyPendingTasks() -> void;
+
+    std::vector<Uptr<Worker>> workers_;
+    std::vector<std::jthread> threads_;
+
+    std::mutex injected_mutex_;
+    std::deque<Task *> injected_;
+    std::atomic<std::size_t> injected_size_{0};
+    // Set under injected_mutex_ once the workers are joined; later submissions are destroyed right away
+    bool stopped_{false};
+
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+    std::atomic<std::size_t> idle_workers_{0};
+    std::atomic<bool> stopping_{false};
+
+    std::atomic<std::size_t> steal_count_{0};
+
+    IdleStrategy idle_strategy_;
+    IdleCounters idle_counters_;
+
+    static thread_local Worker *current_worker_;
+};
+
+} // namespace oxherdcpp
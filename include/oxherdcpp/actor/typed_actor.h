@@ -0,0 +1,148 @@
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <utility>
+#include <vector>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/message/message.h>
+
+namespace oxherdcpp
+{
+
+// The fixed set of messages a typed actor accepts.
+template <typename... Messages> struct Protocol
+{
+    template <typename MessageType> static constexpr bool kAccepts{(std::same_as<MessageType, Messages> || ...)};
+};
+
+// Handlers take either the message itself or, to keep it or to co_await, an MPtr to it by value.
+template <typename ActorType, typename MessageType>
+concept HandlesByReference = requires(ActorType &actor, const MessageType &message) { actor.Handle(message); };
+
+template <typename ActorType, typename MessageType>
+concept HandlesMessage = HandlesByReference<ActorType, MessageType> ||
+                         requires(ActorType &actor, const MPtr<MessageType> &message) { actor.Handle(message); };
+
+// Base of actors whose protocol is known at compile time. Derived declares a Handle overload for every
+// message of the protocol, which is checked when Behaviour is instantiated, and gets messages through a
+// table of plain function pointers indexed by MessageTypeIndex instead of a MessageDispatcher. Messages
+// outside the protocol go to OnUnhandled.
+template <typename Derived, typename... Messages> class TypedActor : public Actor
+{
+  public:
+    using ProtocolType = Protocol<Messages...>;
+
+    using Actor::Actor;
+
+  protected:
+    virtual auto OnUnhandled(const MPtr<BaseMessage> &message) -> void
+    {
+        (void)message;
+    }
+
+  private:
+    using Handler = void (*)(Derived &actor, const MPtr<BaseMessage> &message);
+
+    auto Behaviour(const MPtr<BaseMessage> &message) -> void final
+    {
+        static_assert((HandlesMessage<Derived, Messages> && ...), "TypedActor must handle every protocol message");
+
+        static const auto handlers{MakeHandlerTable()};
+        const auto type_index{message->GetTypeIndex()};
+        if (type_index < handlers.size() && handlers[type_index] != nullptr)
+        {
+            handlers[type_index](static_cast<Derived &>(*this), message);
+            return;
+        }
+        OnUnhandled(message);
+    }
+
+    template <typename MessageType> static auto Invoke(Derived &actor, const MPtr<BaseMessage> &message) -> void
+    {
+        if constexpr (HandlesByReference<Derived, MessageType>)
+        {
+            actor.Handle(static_cast<const MessageType &>(*message));
+        }
+        else
+        {
+            actor.Handle(MPtr<MessageType>{static_cast<MessageType *>(message.get())});
+        }
+    }
+
+    // Shared by every instance of Derived
+    static auto MakeHandlerTable() -> std::vector<Handler>
+    {
+        std::vector<Handler> handlers;
+        const auto add{[&handlers](const MessageTypeIndex type_index, const Handler handler) {
+            if (type_index >= handlers.size())
+            {
+                handlers.resize(type_index + 1, nullptr);
+            }
+            handlers[type_index] = handler;
+        }};
+        (add(Messages::GetClassTypeIndex(), &TypedActor::Invoke<Messages>), ...);
+        return handlers;
+    }
+};
+
+// An ActorRef that only takes the messages of ProtocolType; sending anything else does not compile.
+template <typename ProtocolType> class TypedActorRef
+{
+  public:
+    // The caller vouches that the actor speaks ProtocolType.
+    explicit TypedActorRef(ActorRef actor_ref) : actor_ref_{std::move(actor_ref)}
+    {
+    }
+
+    template <typename ActorType>
+        requires std::same_as<typename ActorType::ProtocolType, ProtocolType>
+    TypedActorRef(const Sptr<ActorType> &actor, Wptr<ActorSystemFacade> system_facade)
+        : actor_ref_{actor, std::move(system_facade)}
+    {
+    }
+
+    template <typename MessageType>
+        requires(ProtocolType::template kAccepts<MessageType>)
+    auto Tell(MPtr<MessageType> message) noexcept -> void
+    {
+        actor_ref_.Tell(std::move(message));
+    }
+
+    template <typename MessageType>
+        requires(ProtocolType::template kAccepts<MessageType>)
+    auto TryTell(MPtr<MessageType> message) noexcept -> bool
+    {
+        return actor_ref_.TryTell(std::move(message));
+    }
+
+    template <typename Response, typename Request>
+        requires(ProtocolType::template kAccepts<Request>)
+    auto Ask(MPtr<Request> request, const std::chrono::steady_clock::duration timeout) -> AskFuture<Response>
+    {
+        return actor_ref_.Ask<Response>(std::move(request), timeout);
+    }
+
+    // Untyped, for code that takes any ActorRef
+    [[nodiscard]] auto GetRef() const -> ActorRef
+    {
+        return actor_ref_;
+    }
+
+    [[nodiscard]] auto GetId() const noexcept -> ActorId
+    {
+        return actor_ref_.GetId();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return static_cast<bool>(actor_ref_);
+    }
+
+  private:
+    ActorRef actor_ref_;
+};
+
+} // namespace oxherdcpp
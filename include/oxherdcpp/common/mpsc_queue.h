@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+
+#include <oxherdcpp/common/helper_macros.h>
+
+namespace oxherdcpp
+{
+
+inline constexpr std::size_t kCacheLineSize{64};
+
+// Unbounded node-based multi-producer/single-consumer queue (Vyukov).
+// Push is wait-free and may be called from any thread; TryPop and IsEmpty belong to the single consumer.
+template <typename T> class MpscQueue
+{
+    struct Node
+    {
+        Node() = default;
+
+        explicit Node(T &&value) : value{std::move(value)}
+        {
+        }
+
+        std::atomic<Node *> next{nullptr};
+        T value{};
+    };
+
+    DISABLE_COPY_AND_MOVE(MpscQueue)
+  public:
+    MpscQueue() : head_{new Node{}}
+    {
+        tail_ = head_.load(std::memory_order_relaxed);
+    }
+
+    ~MpscQueue()
+    {
+        while (TryPop())
+        {
+        }
+        delete tail_;
+    }
+
+    auto Push(T value) -> void
+    {
+        auto *node{new Node{std::move(value)}};
+        auto *prev{head_.exchange(node, std::memory_order_seq_cst)};
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Links the range into a private chain first, so the whole batch is published with a single exchange.
+    template <std::input_iterator Iterator> auto PushBatch(Iterator first, const Iterator last) -> void
+    {
+        if (first == last)
+        {
+            return;
+        }
+        auto *chain_head{new Node{T{*first}}};
+        auto *chain_tail{chain_head};
+        for (++first; first != last; ++first)
+        {
+            auto *node{new Node{T{*first}}};
+            chain_tail->next.store(node, std::memory_order_relaxed);
+            chain_tail = node;
+        }
+        auto *prev{head_.exchange(chain_tail, std::memory_order_seq_cst)};
+        prev->next.store(chain_head, std::memory_order_release);
+    }
+
+    // Returns nullopt when the queue is empty or a producer is between its exchange and link steps.
+    auto TryPop() -> std::optional<T>
+    {
+        auto *tail{tail_};
+        auto *next{tail->next.load(std::memory_order_acquire)};
+        if (next == nullptr)
+        {
+            return std::nullopt;
+        }
+        std::optional<T> value{std::move(next->value)};
+        tail_ = next;
+        delete tail;
+        return value;
+    }
+
+    [[nodiscard]] auto IsEmpty() const -> bool
+    {
+        return head_.load(std::memory_order_seq_cst) == tail_;
+    }
+
+  private:
+    alignas(kCacheLineSize) std::atomic<Node *> head_;
+    alignas(kCacheLineSize) Node *tail_{nullptr};
+};
+
+} // namespace oxherdcpp
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+#include <oxherdcpp/common/helper_macros.h>
+#include <oxherdcpp/common/mpsc_queue.h>
+
+namespace oxherdcpp
+{
+
+// Bounded single-producer/single-consumer ring. TryPush belongs to the producer thread, TryPop to the consumer.
+template <typename T, std::size_t Capacity> class SpscRing
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    DISABLE_COPY_AND_MOVE(SpscRing)
+  public:
+    SpscRing() = default;
+
+    ~SpscRing() = default;
+
+    auto TryPush(T value) -> bool
+    {
+        const auto tail{tail_.load(std::memory_order_relaxed)};
+        if (tail - cached_head_ == Capacity)
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity)
+            {
+                return false;
+            }
+        }
+        buffer_[tail & (Capacity - 1)] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto TryPop() -> std::optional<T>
+    {
+        const auto head{head_.load(std::memory_order_relaxed)};
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+            {
+                return std::nullopt;
+            }
+        }
+        std::optional<T> value{std::move(buffer_[head & (Capacity - 1)])};
+        head_.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+  private:
+    // Each side keeps a stale copy of the other's index and only reloads it when the ring looks full/empty
+    alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_{0};
+    alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_{0};
+    alignas(kCacheLineSize) std::array<T, Capacity> buffer_{};
+};
+
+} // namespace oxherdcpp
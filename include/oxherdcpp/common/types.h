@@ -9,4 +9,13 @@ template <typename T> constexpr auto GetTypeHash() -> std::size_t
     constexpr std::string_view func_name = __PRETTY_FUNCTION__;
     return std::hash<std::string_view>{}(func_name);
 }
+
+// Readable name of T as the compiler spells it, for reports; not stable across compilers
+template <typename T> constexpr auto GetTypeName() -> std::string_view
+{
+    constexpr std::string_view func_name = __PRETTY_FUNCTION__;
+    constexpr std::string_view prefix{"T = "};
+    const auto begin{func_name.find(prefix) + prefix.size()};
+    return func_name.substr(begin, func_name.find_first_of(";]", begin) - begin);
+}
 } // namespace oxherdcpp
\ No newline at end of file
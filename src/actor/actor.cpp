@@ -1,52 +1,58 @@
 #include <oxherdcpp/actor/actor.h>
 
 #include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_system_facade.h>
+#include <oxherdcpp/actor/broadcast.h>
+#include <oxherdcpp/actor/coroutine.h>
 #include <oxherdcpp/actor/events.h>
 #include <oxherdcpp/logger/logger.h>
 
 namespace oxherdcpp
 {
+thread_local Actor *Actor::current_actor_{nullptr};
+
 Actor::Actor(const Executor &executor, std::string name, const ActorId actor_id)
-    : strand_{boost::asio::make_strand(executor)}, name_{std::move(name)}, actor_id_{actor_id}
+    : executor_{executor}, name_{std::move(name)}, actor_id_{actor_id}
 {
-    InitializeMessageHandlers();
 }
 
 Actor::~Actor() = default;
 
 auto Actor::Receive(MPtr<BaseMessage> message) -> void
 {
-    auto completion_token = [weak_self = this->weak_from_this(), message = std::move(message)]() mutable noexcept {
-        const auto base = weak_self.lock();
-        RETURN_IF(base == nullptr, void());
+    (void)TryReceive(std::move(message));
+}
 
-        base->ProcessMessage(message);
-    };
-    try
+auto Actor::TryReceive(MPtr<BaseMessage> message) -> bool
+{
+    auto [accepted, needs_schedule, rejected]{mailbox_.Enqueue(std::move(message))};
+    if (needs_schedule)
     {
-        boost::asio::post(strand_, std::move(completion_token));
+        Schedule();
     }
-    catch (const boost::system::system_error &e)
+    if (rejected)
     {
-        LOG_CRITICAL("Boost system error in post")
-            .SetActorId(GetId())
-            .SetActorName(GetName())
-            .AddContext("exception message", e.what());
-        std::terminate();
+        PublishDeadLetter(std::move(rejected), DeadLetterReason::MailboxOverflow);
     }
-    catch (std::exception &e)
+    return accepted;
+}
+
+auto Actor::ReceiveBatch(std::span<MPtr<BaseMessage>> messages) -> std::size_t
+{
+    if (!mailbox_.CanEnqueueBatch())
     {
-        LOG_CRITICAL("Standart exception in post")
-            .SetActorId(GetId())
-            .SetActorName(GetName())
-            .AddContext("exception message", e.what());
-        std::terminate();
+        std::size_t accepted{0};
+        for (auto &message : messages)
+        {
+            accepted += TryReceive(std::move(message)) ? 1 : 0;
+        }
+        return accepted;
     }
-    catch (...)
+    if (mailbox_.EnqueueBatch(messages))
     {
-        LOG_CRITICAL("Unknown exception in post").SetActorId(GetId()).SetActorName(GetName());
-        std::terminate();
+        Schedule();
     }
+    return messages.size();
 }
 
 auto Actor::GetState() -> ActorState &
@@ -58,6 +64,35 @@ auto Actor::SetContext(Uptr<ActorContext> context) -> void
 {
     context_ = std::move(context);
 }
+
+auto Actor::ApplyOptions(const ActorOptions &options) -> void
+{
+    throughput_ = options.throughput > 0 ? options.throughput : kDefaultThroughput;
+    throughput_deadline_ = options.throughput_deadline;
+    stash_capacity_ = options.stash_capacity.value_or(kDefaultStashCapacity);
+    mailbox_.Configure(options.mailbox.value_or(MailboxConfig{}));
+}
+
+auto Actor::GetThroughput() const -> std::size_t
+{
+    return throughput_;
+}
+
+auto Actor::GetThroughputDeadline() const -> std::chrono::nanoseconds
+{
+    return throughput_deadline_;
+}
+
+auto Actor::GetStashSize() const -> std::size_t
+{
+    return stash_.size();
+}
+
+auto Actor::GetMailbox() const -> const Mailbox &
+{
+    return mailbox_;
+}
+
 auto Actor::GetId() const -> ActorId
 {
     return actor_id_;
@@ -70,7 +105,7 @@ auto Actor::GetName() const -> std::string
 
 auto Actor::GetExecutor() const -> Executor
 {
-    return strand_.get_inner_executor();
+    return executor_;
 }
 
 auto Actor::GetContext() const -> ActorContext &
@@ -123,28 +158,146 @@ auto Actor::OnTerminated() -> void
 {
 }
 
-auto Actor::InitializeMessageHandlers() -> void
+auto Actor::GetSystemMessageHandlers() -> const SystemMessageHandlerTable &
+{
+    static const auto handlers{[] {
+        SystemMessageHandlerTable table;
+        const auto set_handler{[&table](const MessageTypeIndex type_index, const SystemMessageHandler handler) {
+            if (type_index >= table.size())
+            {
+                table.resize(type_index + 1, nullptr);
+            }
+            table[type_index] = handler;
+        }};
+        set_handler(GoStartActor::GetClassTypeIndex(), &Actor::HandleGoStart);
+        set_handler(GoStopActor::GetClassTypeIndex(), &Actor::HandleGoStop);
+        set_handler(GoPauseActor::GetClassTypeIndex(), &Actor::HandleGoPause);
+        set_handler(GoResumeActor::GetClassTypeIndex(), &Actor::HandleGoResume);
+        set_handler(GoTerminateActor::GetClassTypeIndex(), &Actor::HandleGoTerminate);
+        return table;
+    }()};
+    return handlers;
+}
+
+auto Actor::Schedule(const bool is_continuation) -> void
+{
+    auto run{[weak_self = this->weak_from_this()]() noexcept {
+        const auto self = weak_self.lock();
+        RETURN_IF(self == nullptr, void());
+
+        self->Run();
+    }};
+    try
+    {
+        if (is_continuation)
+        {
+            boost::asio::defer(executor_, std::move(run));
+        }
+        else
+        {
+            boost::asio::post(executor_, std::move(run));
+        }
+    }
+    catch (const boost::system::system_error &e)
+    {
+        LOG_CRITICAL("Boost system error in post")
+            .SetActorId(GetId())
+            .SetActorName(GetName())
+            .AddContext("exception message", e.what());
+        std::terminate();
+    }
+    catch (std::exception &e)
+    {
+        LOG_CRITICAL("Standart exception in post")
+            .SetActorId(GetId())
+            .SetActorName(GetName())
+            .AddContext("exception message", e.what());
+        std::terminate();
+    }
+    catch (...)
+    {
+        LOG_CRITICAL("Unknown exception in post").SetActorId(GetId()).SetActorName(GetName());
+        std::terminate();
+    }
+}
+
+auto Actor::PublishDeadLetter(MPtr<BaseMessage> message, const DeadLetterReason reason) -> void
+{
+    const auto facade{context_ ? context_->GetSystem().lock() : nullptr};
+    if (facade == nullptr)
+    {
+        LOG_DEBUG("Dropping undeliverable message").SetActorId(GetId()).SetActorName(GetName());
+        return;
+    }
+    if (message->IsA<BroadcastEnvelope>())
+    {
+        message = static_cast<const BroadcastEnvelope &>(*message).message;
+    }
+    facade->PublishDeadLetter(MakeMessage<DeadLetter>(GetId(), std::move(message), reason));
+}
+
+auto Actor::Run() -> void
 {
-    system_message_handlers_[GetTypeHash<GoStartActor>()] = [this] { HandleGoStart(); };
-    system_message_handlers_[GetTypeHash<GoStopActor>()] = [this] { HandleGoStop(); };
-    system_message_handlers_[GetTypeHash<GoPauseActor>()] = [this] { HandleGoPause(); };
-    system_message_handlers_[GetTypeHash<GoResumeActor>()] = [this] { HandleGoResume(); };
-    system_message_handlers_[GetTypeHash<GoTerminateActor>()] = [this] { HandleGoTerminate(); };
+    using Clock = std::chrono::steady_clock;
+
+    auto *const previous_actor{std::exchange(current_actor_, this)};
+    const bool has_deadline{throughput_deadline_.count() > 0};
+    const auto deadline{has_deadline ? Clock::now() + throughput_deadline_ : Clock::time_point::max()};
+    for (std::size_t processed{0}; processed < throughput_; ++processed)
+    {
+        auto message{mailbox_.Dequeue()};
+        if (message == nullptr)
+        {
+            break;
+        }
+        ProcessMessage(std::move(message));
+        if (has_deadline && Clock::now() >= deadline)
+        {
+            break;
+        }
+    }
+    current_actor_ = previous_actor;
+    if (mailbox_.CompleteTurn())
+    {
+        Schedule(true);
+    }
 }
 
-auto Actor::ProcessMessage(const MPtr<BaseMessage> &message) -> void
+auto Actor::ProcessMessage(MPtr<BaseMessage> message) -> void
 {
-    const auto message_type = message->GetTypeId();
+    const auto type_index{message->GetTypeIndex()};
 
-    if (const auto handler_it = system_message_handlers_.find(message_type);
-        handler_it != system_message_handlers_.end())
+    if (type_index == ResumeCoroutine::GetClassTypeIndex())
+    {
+        HandleResumption(std::move(message));
+        return;
+    }
+    if (type_index == BroadcastEnvelope::GetClassTypeIndex())
     {
-        handler_it->second();
+        // The envelope keeps the shared message alive for the turn. Borrowing it spares every recipient an
+        // increment and a decrement of the one counter all of them share.
+        const auto &shared{static_cast<const BroadcastEnvelope &>(*message).message};
+        if (!HandleSystemMessage(shared->GetTypeIndex()))
+        {
+            HandleUserMessage(shared);
+        }
+        return;
+    }
+    if (!HandleSystemMessage(type_index))
+    {
+        HandleUserMessage(std::move(message));
     }
-    else
+}
+
+auto Actor::HandleSystemMessage(const MessageTypeIndex type_index) -> bool
+{
+    const auto &handlers{GetSystemMessageHandlers()};
+    if (type_index >= handlers.size() || !handlers[type_index])
     {
-        HandleUserMessage(message);
+        return false;
     }
+    (this->*handlers[type_index])();
+    return true;
 }
 
 auto Actor::HandleGoStart() -> void
@@ -163,6 +316,7 @@ auto Actor::HandleGoStart() -> void
     {
         state_.Dispatch(StartedEvent{});
         OnStarted();
+        Unstash();
     }
 }
 
@@ -172,6 +326,8 @@ auto Actor::HandleGoStop() -> void
         state_.HasCurrentState<StartingState>())
     {
         state_.Dispatch(StopEvent{});
+        parked_resumptions_.clear();
+        DiscardStash();
         OnStop();
     }
     if (state_.HasCurrentState<StoppingState>())
@@ -196,6 +352,7 @@ auto Actor::HandleGoResume() -> void
     {
         state_.Dispatch(ResumeEvent{});
         OnResume();
+        Unstash();
     }
 }
 
@@ -204,6 +361,8 @@ auto Actor::HandleGoTerminate() -> void
     if (!state_.HasCurrentState<TerminatedState>())
     {
         state_.Dispatch(TerminateEvent{});
+        parked_resumptions_.clear();
+        DiscardStash();
         OnTerminate();
     }
     if (state_.HasCurrentState<TerminatingState>())
@@ -213,29 +372,117 @@ auto Actor::HandleGoTerminate() -> void
     }
 }
 
-auto Actor::HandleUserMessage(const MPtr<BaseMessage> &message) -> void
+template <typename MessagePtr> auto Actor::HandleUserMessageImpl(MessagePtr &&message) -> void
 {
     if (!state_.IsRunning())
     {
+        if (IsStashing())
+        {
+            Stash(std::forward<MessagePtr>(message));
+        }
         return;
     }
+    current_message_ = &message;
     try
     {
         Behaviour(message);
     }
     catch (...)
     {
-        state_.Dispatch(FailureEvent{});
-        auto failure_event{MakeMessage<ActorFailureEvent>()};
-        failure_event->actor_id = GetId();
-        failure_event->actor_name = GetName();
-        failure_event->cause = std::current_exception();
-        failure_event->failed_message = message;
+        ReportFailure(std::current_exception(), std::forward<MessagePtr>(message));
+    }
+    current_message_ = nullptr;
+}
+
+auto Actor::HandleUserMessage(MPtr<BaseMessage> &&message) -> void
+{
+    HandleUserMessageImpl(std::move(message));
+}
+
+auto Actor::HandleUserMessage(const MPtr<BaseMessage> &message) -> void
+{
+    HandleUserMessageImpl(message);
+}
+
+auto Actor::HandleResumption(MPtr<BaseMessage> message) -> void
+{
+    if (state_.IsRunning())
+    {
+        static_cast<ResumeCoroutine &>(*message).Resume();
+        return;
+    }
+    if (IsStashing())
+    {
+        parked_resumptions_.push_back(std::move(message));
+    }
+    // Otherwise the coroutine is destroyed with the message
+}
+
+auto Actor::IsStashing() const -> bool
+{
+    return state_.HasCurrentState<CreatedState>() || state_.HasCurrentState<InitializingState>() ||
+           state_.HasCurrentState<StartingState>() || state_.IsPaused();
+}
+
+auto Actor::Stash(MPtr<BaseMessage> message) -> void
+{
+    if (stash_.size() >= stash_capacity_)
+    {
+        if (stash_capacity_ > 0)
+        {
+            PublishDeadLetter(std::move(message), DeadLetterReason::StashOverflow);
+        }
+        return;
+    }
+    stash_.push_back(std::move(message));
+}
 
-        if (const auto parent{GetContext().GetParent().lock()})
+auto Actor::Unstash() -> void
+{
+    if (!parked_resumptions_.empty())
+    {
+        auto parked{std::move(parked_resumptions_)};
+        parked_resumptions_.clear();
+        for (auto &resumption : parked)
         {
-            parent->Receive(std::move(failure_event));
+            HandleResumption(std::move(resumption));
         }
     }
+    if (stash_.empty())
+    {
+        return;
+    }
+    // A replayed message may fail or pause the actor, the rest then stays stashed or is dropped as usual
+    auto stashed{std::move(stash_)};
+    stash_.clear();
+    for (auto &message : stashed)
+    {
+        HandleUserMessage(std::move(message));
+    }
+}
+
+auto Actor::DiscardStash() -> void
+{
+    auto stashed{std::move(stash_)};
+    stash_.clear();
+    for (auto &message : stashed)
+    {
+        PublishDeadLetter(std::move(message), DeadLetterReason::StashDiscarded);
+    }
+}
+
+auto Actor::ReportFailure(std::exception_ptr cause, MPtr<BaseMessage> message) -> void
+{
+    state_.Dispatch(FailureEvent{});
+    auto failure_event{MakeMessage<ActorFailureEvent>()};
+    failure_event->actor_id = GetId();
+    failure_event->actor_name = GetName();
+    failure_event->cause = std::move(cause);
+    failure_event->failed_message = std::move(message);
+
+    if (const auto parent{GetContext().GetParent().lock()})
+    {
+        parent->Receive(std::move(failure_event));
+    }
 }
 } // namespace oxherdcpp
\ No newline at end of file
@@ -28,7 +28,80 @@ auto ActorContext::GetExecutor() -> boost::asio::any_io_executor
     return executor_;
 }
 
-auto ActorContext::HandleChildFailure(const MPtr<ActorFailureEvent> &failure_event) -> void
+auto ActorContext::GetSystem() const -> Wptr<ActorSystemFacade>
+{
+    return system_facade_;
+}
+
+auto ActorContext::GetDefaultActorOptions() const -> ActorOptions
+{
+    if (const auto facade{system_facade_.lock()})
+    {
+        return facade->GetDefaultActorOptions();
+    }
+    return ActorOptions{.throughput = kDefaultThroughput};
+}
+
+auto ActorContext::SelectExecutor(const ActorOptions &options, const ActorId actor_id) const
+    -> boost::asio::any_io_executor
+{
+    if (const auto facade{system_facade_.lock()})
+    {
+        return facade->SelectExecutor(options, actor_id, executor_);
+    }
+    return executor_;
+}
+
+auto ActorContext::ScheduleOnce(const TimingWheel::Duration delay, MPtr<BaseMessage> message) -> TimerHandle
+{
+    return ScheduleOnce(delay, ActorRef{self_.shared_from_this(), system_facade_}, std::move(message));
+}
+
+auto ActorContext::ScheduleOnce(const TimingWheel::Duration delay, ActorRef target, MPtr<BaseMessage> message)
+    -> TimerHandle
+{
+    if (const auto facade{system_facade_.lock()})
+    {
+        return facade->ScheduleOnce(delay, std::move(target), std::move(message));
+    }
+    return TimerHandle{};
+}
+
+auto ActorContext::ScheduleAtFixedRate(const TimingWheel::Duration initial_delay,
+                                       const TimingWheel::Duration interval, MPtr<BaseMessage> message)
+    -> TimerHandle
+{
+    return ScheduleAtFixedRate(initial_delay, interval, ActorRef{self_.shared_from_this(), system_facade_},
+                               std::move(message));
+}
+
+auto ActorContext::ScheduleAtFixedRate(const TimingWheel::Duration initial_delay,
+                                       const TimingWheel::Duration interval, ActorRef target,
+                                       MPtr<BaseMessage> message) -> TimerHandle
+{
+    if (const auto facade{system_facade_.lock()})
+    {
+        return facade->ScheduleAtFixedRate(initial_delay, interval, std::move(target), std::move(message));
+    }
+    return TimerHandle{};
+}
+
+auto ActorContext::Cancel(const TimerHandle handle) -> bool
+{
+    if (const auto facade{system_facade_.lock()})
+    {
+        return facade->Cancel(handle);
+    }
+    return false;
+}
+
+auto ActorContext::GetChild(const ActorId child_id) const -> Sptr<Actor>
+{
+    const auto child_it{children_.find(child_id)};
+    return child_it != children_.end() ? child_it->second.actor : nullptr;
+}
+
+auto ActorContext::HandleChildFailure(const MPtr<ActorFailureEvent> &failure_event) -> Directive
 {
     auto escalate_to_parent{[this, failure_event] {
         if (const auto parent = parent_.lock())
@@ -45,12 +118,13 @@ auto ActorContext::HandleChildFailure(const MPtr<ActorFailureEvent> &failure_eve
     if (child_it == children_.end() || child_it->second.strategy == nullptr)
     {
         escalate_to_parent();
-        return;
+        return Directive::Escalate;
     }
     const auto &info{child_it->second};
     const auto &actor{info.actor};
 
-    switch (const auto &strategy{info.strategy}; strategy->Decide(failure_event))
+    const auto directive{info.strategy->Decide(failure_event)};
+    switch (directive)
     {
     case Directive::Resume:
         actor->Receive(MakeMessage<GoResumeActor>());
@@ -70,6 +144,7 @@ auto ActorContext::HandleChildFailure(const MPtr<ActorFailureEvent> &failure_eve
         escalate_to_parent();
         break;
     }
+    return directive;
 }
 
 auto ActorContext::SpawnChildImpl(std::function<Sptr<Actor>()> factory, Uptr<SupervisionStrategy> strategy) -> ActorRef
@@ -77,7 +152,8 @@ auto ActorContext::SpawnChildImpl(std::function<Sptr<Actor>()> factory, Uptr<Sup
     auto child{factory()};
     auto ref{ActorRef{child, system_facade_}};
 
-    children_[child->GetId()] =
+    const auto child_id{child->GetId()};
+    children_[child_id] =
         ChildInfo{.actor = std::move(child), .strategy = std::move(strategy), .factory = std::move(factory)};
 
     return ref;
@@ -94,17 +170,17 @@ auto ActorContext::RestartChildActor(ChildInfo &child_info) -> void
 
     children_.erase(actor->GetId());
 
-    ChildInfo info{};
-    info.actor = old_factory();
-    info.strategy = std::move(old_strategy);
-    info.factory = std::move(old_factory);
-    children_[info.actor->GetId()] = std::move(info);
+    auto restarted{old_factory()};
+    const auto restarted_id{restarted->GetId()};
+    children_[restarted_id] =
+        ChildInfo{.actor = restarted, .strategy = std::move(old_strategy), .factory = std::move(old_factory)};
 
     if (const auto sys{system_facade_.lock()})
     {
         sys->GetActorRegistry().Tell(
-            MakeMessage<RegisterActorMessage>(info.actor->GetId(), ActorRef{info.actor, system_facade_}));
+            MakeMessage<RegisterActorMessage>(restarted_id, ActorRef{restarted, system_facade_}));
     }
+    restarted->Receive(MakeMessage<GoStartActor>());
 }
 
 } // namespace oxherdcpp
\ No newline at end of file
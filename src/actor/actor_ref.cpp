@@ -25,8 +25,9 @@ auto ActorRef::Tell(MPtr<BaseMessage> message) noexcept -> void
     }
     if (const auto facade{system_facade_.lock()})
     {
-        auto cb{[this, msg = std::move(message)](ActorRef ref) {
-            ref.Tell(msg);
+        // The registry calls it once, so the message moves on without touching its reference count
+        auto cb{[this, msg = std::move(message)](ActorRef ref) mutable {
+            ref.Tell(std::move(msg));
             cached_actor_ = ref.cached_actor_;
         }};
         auto msg{MakeMessage<FindActorWithCallbackMessage>()};
@@ -40,6 +41,48 @@ auto ActorRef::Tell(MPtr<BaseMessage> message) noexcept -> void
     }
 }
 
+auto ActorRef::TryTell(MPtr<BaseMessage> message) noexcept -> bool
+{
+    if (const auto actor{cached_actor_.lock()})
+    {
+        return actor->TryReceive(std::move(message));
+    }
+    if (system_facade_.expired())
+    {
+        return false;
+    }
+    Tell(std::move(message));
+    return true;
+}
+
+auto ActorRef::TellBatch(std::span<MPtr<BaseMessage>> messages) noexcept -> void
+{
+    if (const auto actor{cached_actor_.lock()})
+    {
+        actor->ReceiveBatch(messages);
+        return;
+    }
+    for (auto &message : messages)
+    {
+        Tell(std::move(message));
+    }
+}
+
+auto ActorRef::ArmAskTimeout(Sptr<ReplySlot> slot, const std::chrono::steady_clock::duration timeout) -> void
+{
+    // Without a system to time it out, only AskFuture::Get gives up on the reply
+    if (const auto facade{system_facade_.lock()})
+    {
+        const auto timer{facade->ScheduleCallback(timeout, [slot] { slot->Expire(); })};
+        slot->SetTimeout(timer, system_facade_);
+    }
+}
+
+auto ActorRef::GetId() const noexcept -> ActorId
+{
+    return actor_id_;
+}
+
 ActorRef::operator bool() const noexcept
 {
     return !cached_actor_.expired();
@@ -38,11 +38,11 @@ auto ActorRegistry::HandleFindActor(const MPtr<FindActorMessage> &message) -> vo
 {
     if (const auto found_it{actors_.find(message->actor_id)}; found_it != actors_.end())
     {
-        message->reply_to.Tell(MakeMessage<ActorFoundResponseMessage>(found_it->second));
+        message->reply_to.Tell(MakeMessage<ActorFoundResponseMessage>(found_it->second, message->request_id));
     }
     else
     {
-        message->reply_to.Tell(MakeMessage<ActorNotFoundResponseMessage>(message->actor_id));
+        message->reply_to.Tell(MakeMessage<ActorNotFoundResponseMessage>(message->actor_id, message->request_id));
     }
 }
 
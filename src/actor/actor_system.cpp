@@ -1,14 +1,28 @@
 #include <oxherdcpp/actor/actor_system.h>
 
+#include <stdexcept>
+
 #include <oxherdcpp/actor/actor_registry.h>
+#include <oxherdcpp/actor/dead_letter_office.h>
 #include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/sharded_runtime.h>
+#include <oxherdcpp/actor/scheduler/work_stealing_scheduler.h>
 
 namespace oxherdcpp
 {
 ActorSystem::ActorSystem(std::string name, const std::size_t thread_count)
-    : name_(std::move(name)), work_guard_{boost::asio::make_work_guard(io_context_)},
-      thread_count_{thread_count > 0 ? thread_count : 1}
+    : ActorSystem{std::move(name), ActorSystemConfig{.thread_count = thread_count}}
+{
+}
+
+ActorSystem::ActorSystem(std::string name, ActorSystemConfig config)
+    : name_(std::move(name)), config_{std::move(config)}, work_guard_{boost::asio::make_work_guard(io_context_)}
 {
+    config_.thread_count = std::max<std::size_t>(config_.thread_count, 1);
+    if (config_.default_actor_options.throughput == 0)
+    {
+        config_.default_actor_options.throughput = kDefaultThroughput;
+    }
     InitRuntime();
     InitServices();
 }
@@ -21,11 +35,125 @@ ActorSystem::~ActorSystem()
     }
 }
 
+auto ActorSystem::GetDefaultActorOptions() const -> ActorOptions
+{
+    return config_.default_actor_options;
+}
+
 auto ActorSystem::GetExecutor() -> boost::asio::any_io_executor
 {
+    if (work_stealing_scheduler_)
+    {
+        return work_stealing_scheduler_->get_executor();
+    }
+    if (sharded_runtime_)
+    {
+        return sharded_runtime_->GetExecutor(0);
+    }
     return io_context_.get_executor();
 }
 
+auto ActorSystem::GetShardExecutor(const std::size_t shard) -> boost::asio::any_io_executor
+{
+    if (sharded_runtime_)
+    {
+        return sharded_runtime_->GetExecutor(shard);
+    }
+    return GetExecutor();
+}
+
+auto ActorSystem::GetShardCount() const -> std::size_t
+{
+    return sharded_runtime_ ? sharded_runtime_->GetShardCount() : 1;
+}
+
+auto ActorSystem::GetIdleStats() const -> IdleStats
+{
+    if (work_stealing_scheduler_)
+    {
+        return work_stealing_scheduler_->GetIdleStats();
+    }
+    if (sharded_runtime_)
+    {
+        return sharded_runtime_->GetIdleStats();
+    }
+    return idle_counters_.GetStats();
+}
+
+auto ActorSystem::GetDispatcher(const std::string_view name) const -> Dispatcher *
+{
+    for (const auto &dispatcher : dispatchers_)
+    {
+        if (dispatcher->GetConfig().name == name)
+        {
+            return dispatcher.get();
+        }
+    }
+    return nullptr;
+}
+
+auto ActorSystem::SelectExecutor(const ActorOptions &options, const ActorId actor_id,
+                                 const boost::asio::any_io_executor &parent_executor) -> boost::asio::any_io_executor
+{
+    if (!options.dispatcher.empty() && options.dispatcher != kDefaultDispatcher)
+    {
+        auto *dispatcher{GetDispatcher(options.dispatcher)};
+        if (dispatcher == nullptr)
+        {
+            throw std::invalid_argument{"Unknown dispatcher: " + options.dispatcher};
+        }
+        return dispatcher->AcquireExecutor();
+    }
+    if (!sharded_runtime_)
+    {
+        return GetExecutor();
+    }
+    const auto hashed{[&] { return GetShardExecutor(std::hash<ActorId>{}(actor_id)); }};
+    switch (options.placement)
+    {
+    case ShardPlacement::Explicit:
+        return GetShardExecutor(options.shard);
+    case ShardPlacement::Hashed:
+        return hashed();
+    case ShardPlacement::Auto:
+    case ShardPlacement::SameAsParent:
+        break;
+    }
+    // A parent running on another dispatcher has no shard to share
+    if (parent_executor && parent_executor.target<ShardedRuntime::executor_type>() != nullptr)
+    {
+        return parent_executor;
+    }
+    return hashed();
+}
+
+auto ActorSystem::ScheduleOnce(const TimingWheel::Duration delay, ActorRef target, MPtr<BaseMessage> message)
+    -> TimerHandle
+{
+    return timing_wheel_->ScheduleOnce(delay, std::move(target), std::move(message));
+}
+
+auto ActorSystem::ScheduleAtFixedRate(const TimingWheel::Duration initial_delay, const TimingWheel::Duration interval,
+                                      ActorRef target, MPtr<BaseMessage> message) -> TimerHandle
+{
+    return timing_wheel_->ScheduleAtFixedRate(initial_delay, interval, std::move(target), std::move(message));
+}
+
+auto ActorSystem::ScheduleCallback(const TimingWheel::Duration delay, std::function<void()> callback) -> TimerHandle
+{
+    return timing_wheel_->ScheduleCallback(delay, std::move(callback));
+}
+
+auto ActorSystem::Cancel(const TimerHandle handle) -> bool
+{
+    return timing_wheel_->Cancel(handle);
+}
+
+auto ActorSystem::GetTimingWheel() -> TimingWheel &
+{
+    return *timing_wheel_;
+}
+
 auto ActorSystem::GetActorRegistry() -> ActorRef
 {
     return ActorRef{actor_registry_, this->weak_from_this()};
@@ -35,21 +163,61 @@ auto ActorSystem::DispatchMessage(const ActorId actor_id, MPtr<BaseMessage> mess
 {
     auto find_request = MakeMessage<FindActorWithCallbackMessage>();
 
-    auto cb{[msg = std::move(message)](ActorRef ref) { ref.Tell(msg); }};
+    auto cb{[msg = std::move(message)](ActorRef ref) mutable { ref.Tell(std::move(msg)); }};
     find_request->actor_id = actor_id;
     find_request->callback = std::move(cb);
 
     actor_registry_->Receive(std::move(find_request));
 }
 
+auto ActorSystem::PublishDeadLetter(MPtr<DeadLetter> dead_letter) -> void
+{
+    dead_letters_->Receive(std::move(dead_letter));
+}
+
+auto ActorSystem::GetDeadLetters() -> ActorRef
+{
+    return ActorRef{dead_letters_, this->weak_from_this()};
+}
+
+auto ActorSystem::GetDeadLetterCount() const -> std::size_t
+{
+    return dead_letters_->GetDeadLetterCount();
+}
+
+auto ActorSystem::Broadcast(const std::span<ActorRef> recipients, MPtr<BaseMessage> message,
+                            const BroadcastOptions &options) -> void
+{
+    oxherdcpp::Broadcast(recipients, std::move(message), options, GetExecutor());
+}
+
+auto ActorSystem::Broadcast(BroadcastGroup &group, MPtr<BaseMessage> message) -> void
+{
+    group.Broadcast(std::move(message), GetExecutor());
+}
+
 auto ActorSystem::Stop() -> void
 {
     if (!is_running_.exchange(false))
     {
         return;
     }
+    // Timers stop first so no message is delivered to a scheduler that is shutting down
+    timing_wheel_->Stop();
     work_guard_.reset();
     thread_pool_.clear();
+    if (work_stealing_scheduler_)
+    {
+        work_stealing_scheduler_->Stop();
+    }
+    if (sharded_runtime_)
+    {
+        sharded_runtime_->Stop();
+    }
+    for (const auto &dispatcher : dispatchers_)
+    {
+        dispatcher->Stop();
+    }
 
     if (!io_context_.stopped())
     {
@@ -59,17 +227,63 @@ auto ActorSystem::Stop() -> void
 
 auto ActorSystem::InitRuntime() -> void
 {
-    thread_pool_.reserve(thread_count_);
-    for (std::size_t i = 0; i < thread_count_; ++i)
+    is_running_ = true;
+    timing_wheel_ = MakeUptr<TimingWheel>(config_.timer_tick);
+    for (const auto &dispatcher : config_.dispatchers)
     {
-        thread_pool_.emplace_back([this] { io_context_.run(); });
+        dispatchers_.push_back(MakeUptr<Dispatcher>(dispatcher));
+    }
+    if (GetDispatcher(kBlockingDispatcher) == nullptr)
+    {
+        dispatchers_.push_back(MakeUptr<Dispatcher>(DispatcherConfig{.name = std::string{kBlockingDispatcher},
+                                                                     .kind = DispatcherKind::ThreadPool,
+                                                                     .thread_count = kDefaultBlockingThreadCount}));
+    }
+    auto worker_cpus{ResolveWorkerCpuSets(config_.affinity, config_.thread_count)};
+    if (config_.scheduler == SchedulerKind::WorkStealing)
+    {
+        work_stealing_scheduler_ = MakeUptr<WorkStealingScheduler>(config_.thread_count, std::move(worker_cpus),
+                                                                   config_.idle);
+        return;
+    }
+    if (config_.scheduler == SchedulerKind::Sharded)
+    {
+        sharded_runtime_ = MakeUptr<ShardedRuntime>(config_.thread_count, std::move(worker_cpus), config_.idle);
+        return;
+    }
+    thread_pool_.reserve(config_.thread_count);
+    for (std::size_t i = 0; i < config_.thread_count; ++i)
+    {
+        thread_pool_.emplace_back([this, i, cpus = std::move(worker_cpus[i])] {
+            PinWorkerThread(i, cpus);
+            RunIoContext(io_context_, config_.idle, idle_counters_);
+        });
     }
-    is_running_ = true;
 }
 
 auto ActorSystem::InitServices() -> void
 {
-    actor_registry_ = CreateActor<ActorRegistry>("system/actor-registry");
+    // System services must never lose messages, whatever the default mailbox is
+    const ActorOptions service_options{.mailbox = MailboxConfig{}};
+
+    actor_registry_ = CreateActor<ActorRegistry>(service_options, "system/actor-registry");
     actor_registry_->Receive(MakeMessage<GoStartActor>());
+
+    dead_letters_ = CreateActor<DeadLetterOffice>(service_options, "system/dead-letters");
+    dead_letters_->Receive(MakeMessage<GoStartActor>());
+
+    if (config_.pool_trim_interval > TimingWheel::Duration::zero())
+    {
+        SchedulePoolTrim();
+    }
+}
+
+auto ActorSystem::SchedulePoolTrim() -> void
+{
+    // The wheel stops before the system goes away, so the callback never outlives this
+    timing_wheel_->ScheduleCallback(config_.pool_trim_interval, [this] {
+        TrimAllPools();
+        SchedulePoolTrim();
+    });
 }
 } // namespace oxherdcpp
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <oxherdcpp/actor/ask.h>
+
+#include <string>
+
+#include <oxherdcpp/actor/actor_system_facade.h>
+
+namespace oxherdcpp
+{
+
+AskTimeoutError::AskTimeoutError(const RequestId request_id)
+    : std::runtime_error{"Ask timed out, request " + std::to_string(request_id)}, request_id{request_id}
+{
+}
+
+ReplySlot::ReplySlot(const RequestId request_id, Callback callback)
+    : request_id_{request_id}, callback_{std::move(callback)}
+{
+}
+
+auto ReplySlot::Complete(MPtr<BaseMessage> reply) -> bool
+{
+    return Finish(AskStatus::Replied, std::move(reply));
+}
+
+auto ReplySlot::Expire() -> bool
+{
+    return Finish(AskStatus::TimedOut, nullptr);
+}
+
+auto ReplySlot::Wait(const std::chrono::steady_clock::time_point deadline) -> AskStatus
+{
+    {
+        std::unique_lock lock{mutex_};
+        if (completed_.wait_until(lock, deadline, [this] { return GetStatus() != AskStatus::Pending; }))
+        {
+            return GetStatus();
+        }
+    }
+    // A reply racing with the deadline may still win
+    Expire();
+    std::unique_lock lock{mutex_};
+    completed_.wait(lock, [this] { return GetStatus() != AskStatus::Pending; });
+    return GetStatus();
+}
+
+auto ReplySlot::GetStatus() const -> AskStatus
+{
+    return status_.load(std::memory_order_acquire);
+}
+
+auto ReplySlot::GetReply() const -> MPtr<BaseMessage>
+{
+    return GetStatus() == AskStatus::Replied ? reply_ : nullptr;
+}
+
+auto ReplySlot::GetRequestId() const -> RequestId
+{
+    return request_id_;
+}
+
+auto ReplySlot::OnComplete(std::function<void()> continuation) -> bool
+{
+    std::lock_guard lock{mutex_};
+    if (GetStatus() != AskStatus::Pending)
+    {
+        return false;
+    }
+    continuation_ = std::move(continuation);
+    return true;
+}
+
+auto ReplySlot::SetTimeout(const TimerHandle timer, Wptr<ActorSystemFacade> facade) -> void
+{
+    timer_ = timer;
+    facade_ = std::move(facade);
+}
+
+auto ReplySlot::Finish(const AskStatus status, MPtr<BaseMessage> reply) -> bool
+{
+    if (is_claimed_.exchange(true, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+    // Frees the timer before anyone can observe the reply
+    if (status == AskStatus::Replied && timer_)
+    {
+        if (const auto facade{facade_.lock()})
+        {
+            facade->Cancel(timer_);
+        }
+    }
+    reply_ = std::move(reply);
+    std::function<void()> continuation;
+    {
+        std::lock_guard lock{mutex_};
+        status_.store(status, std::memory_order_release);
+        continuation.swap(continuation_);
+    }
+    completed_.notify_all();
+    if (callback_)
+    {
+        callback_(reply_);
+    }
+    if (continuation)
+    {
+        continuation();
+    }
+    return true;
+}
+
+ReplyTo::ReplyTo(Sptr<ReplySlot> slot) : slot_{std::move(slot)}
+{
+}
+
+auto ReplyTo::Tell(MPtr<BaseMessage> reply) const -> bool
+{
+    return slot_ && slot_->Complete(std::move(reply));
+}
+
+auto ReplyTo::GetRequestId() const -> RequestId
+{
+    return slot_ ? slot_->GetRequestId() : RequestId{};
+}
+
+ReplyTo::operator bool() const noexcept
+{
+    return slot_ != nullptr;
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,116 @@
+#include <oxherdcpp/actor/broadcast.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace oxherdcpp
+{
+namespace
+{
+// Shards are claimed one at a time by the caller and by the helpers posted to the executor. A helper that
+// starts after every shard was claimed finds nothing left and never touches the recipients.
+struct BroadcastRun
+{
+    BroadcastRun(const std::span<ActorRef> recipients, MPtr<BaseMessage> message, const std::size_t shard_size)
+        : recipients{recipients}, message{std::move(message)}, shard_size{shard_size},
+          shard_count{(recipients.size() + shard_size - 1) / shard_size}
+    {
+    }
+
+    // Returns after enqueuing no more shards
+    auto Drain() -> void
+    {
+        for (auto shard{next_shard.fetch_add(1, std::memory_order_relaxed)}; shard < shard_count;
+             shard = next_shard.fetch_add(1, std::memory_order_relaxed))
+        {
+            const auto first{shard * shard_size};
+            const auto shard_recipients{recipients.subspan(first, std::min(shard_size, recipients.size() - first))};
+            // The references of the whole shard are taken with one locked add, every Tell adopts one of them
+            // and the last recipient gets the envelope's own
+            MPtr<BaseMessage> envelope{MakeMessage<BroadcastEnvelope>(message)};
+            envelope->AddReferences(static_cast<std::uint32_t>(shard_recipients.size() - 1));
+            for (auto &recipient : shard_recipients.first(shard_recipients.size() - 1))
+            {
+                recipient.Tell(MPtr<BaseMessage>{envelope.get(), false});
+            }
+            shard_recipients.back().Tell(std::move(envelope));
+            done_shards.fetch_add(1, std::memory_order_release);
+            done_shards.notify_all();
+        }
+    }
+
+    auto WaitUntilDone() -> void
+    {
+        for (auto done{done_shards.load(std::memory_order_acquire)}; done < shard_count;
+             done = done_shards.load(std::memory_order_acquire))
+        {
+            done_shards.wait(done, std::memory_order_acquire);
+        }
+    }
+
+    std::span<ActorRef> recipients;
+    MPtr<BaseMessage> message;
+    std::size_t shard_size;
+    std::size_t shard_count;
+    std::atomic<std::size_t> next_shard{0};
+    std::atomic<std::size_t> done_shards{0};
+};
+} // namespace
+
+auto Broadcast(const std::span<ActorRef> recipients, MPtr<BaseMessage> message, const BroadcastOptions &options,
+               const boost::asio::any_io_executor &executor) -> void
+{
+    if (recipients.empty() || message == nullptr)
+    {
+        return;
+    }
+    const auto shard_size{std::max<std::size_t>(options.shard_size, 1)};
+    const auto run{MakeSptr<BroadcastRun>(recipients, std::move(message), shard_size)};
+    const bool is_parallel{executor && options.parallel_threshold > 0 &&
+                           recipients.size() >= options.parallel_threshold && run->shard_count > 1};
+    if (!is_parallel)
+    {
+        run->Drain();
+        return;
+    }
+    const auto helpers{std::min<std::size_t>(run->shard_count - 1, std::max(1u, std::thread::hardware_concurrency()))};
+    for (std::size_t i{0}; i < helpers; ++i)
+    {
+        boost::asio::post(executor, [run] { run->Drain(); });
+    }
+    run->Drain();
+    run->WaitUntilDone();
+}
+
+BroadcastGroup::BroadcastGroup(BroadcastOptions options) : options_{options}
+{
+}
+
+BroadcastGroup::BroadcastGroup(std::vector<ActorRef> recipients, BroadcastOptions options)
+    : recipients_{std::move(recipients)}, options_{options}
+{
+}
+
+auto BroadcastGroup::Add(ActorRef recipient) -> void
+{
+    recipients_.push_back(std::move(recipient));
+}
+
+auto BroadcastGroup::GetSize() const -> std::size_t
+{
+    return recipients_.size();
+}
+
+auto BroadcastGroup::GetOptions() const -> const BroadcastOptions &
+{
+    return options_;
+}
+
+auto BroadcastGroup::Broadcast(MPtr<BaseMessage> message, const boost::asio::any_io_executor &executor) -> void
+{
+    oxherdcpp::Broadcast(recipients_, std::move(message), options_, executor);
+}
+
+} // namespace oxherdcpp
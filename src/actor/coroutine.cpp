@@ -0,0 +1,176 @@
+#include <oxherdcpp/actor/coroutine.h>
+
+#include <new>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_system_facade.h>
+
+namespace oxherdcpp
+{
+namespace
+{
+// Every frame starts with a reference to its pool, which keeps the pool alive until the last frame is gone
+using PoolReference = Sptr<CoroutineFramePool>;
+
+constexpr std::size_t kFrameHeaderSize{(sizeof(PoolReference) + alignof(std::max_align_t) - 1) /
+                                       alignof(std::max_align_t) * alignof(std::max_align_t)};
+} // namespace
+
+auto CoroutineFramePool::Allocate(const std::size_t size) -> void *
+{
+    std::lock_guard lock{mutex_};
+    ++live_frames_;
+    return pool_.allocate(size, alignof(std::max_align_t));
+}
+
+auto CoroutineFramePool::Deallocate(void *ptr, const std::size_t size) -> void
+{
+    std::lock_guard lock{mutex_};
+    --live_frames_;
+    pool_.deallocate(ptr, size, alignof(std::max_align_t));
+}
+
+auto CoroutineFramePool::GetLiveFrameCount() const -> std::size_t
+{
+    std::lock_guard lock{mutex_};
+    return live_frames_;
+}
+
+auto CoroutineAccess::GetCurrentActor() -> Actor *
+{
+    return Actor::current_actor_;
+}
+
+auto CoroutineAccess::GetFramePool(Actor &actor) -> Sptr<CoroutineFramePool>
+{
+    if (!actor.coroutine_frames_)
+    {
+        actor.coroutine_frames_ = MakeSptr<CoroutineFramePool>();
+    }
+    return actor.coroutine_frames_;
+}
+
+auto CoroutineAccess::GetCurrentMessage(const Actor &actor) -> MPtr<BaseMessage>
+{
+    return actor.current_message_ != nullptr ? *actor.current_message_ : nullptr;
+}
+
+auto CoroutineAccess::GetSystem(const Actor &actor) -> Sptr<ActorSystemFacade>
+{
+    return actor.context_ ? actor.context_->GetSystem().lock() : nullptr;
+}
+
+auto CoroutineAccess::ReportFailure(Actor &actor, std::exception_ptr cause, const MPtr<BaseMessage> &message) -> void
+{
+    actor.ReportFailure(std::move(cause), message);
+}
+
+ActorTask::promise_type::promise_type()
+{
+    if (auto *actor{CoroutineAccess::GetCurrentActor()})
+    {
+        actor_ = actor->weak_from_this();
+        message_ = CoroutineAccess::GetCurrentMessage(*actor);
+    }
+}
+
+auto ActorTask::promise_type::operator new(const std::size_t size) -> void *
+{
+    auto *actor{CoroutineAccess::GetCurrentActor()};
+    auto pool{actor != nullptr ? CoroutineAccess::GetFramePool(*actor) : nullptr};
+    auto *raw{pool ? pool->Allocate(kFrameHeaderSize + size) : ::operator new(kFrameHeaderSize + size)};
+    new (raw) PoolReference{std::move(pool)};
+    return static_cast<std::byte *>(raw) + kFrameHeaderSize;
+}
+
+auto ActorTask::promise_type::operator delete(void *ptr, const std::size_t size) noexcept -> void
+{
+    auto *raw{static_cast<std::byte *>(ptr) - kFrameHeaderSize};
+    auto *reference{std::launder(reinterpret_cast<PoolReference *>(raw))};
+    const auto pool{std::move(*reference)};
+    reference->~PoolReference();
+    if (pool)
+    {
+        pool->Deallocate(raw, kFrameHeaderSize + size);
+        return;
+    }
+    ::operator delete(raw, kFrameHeaderSize + size);
+}
+
+auto ActorTask::promise_type::unhandled_exception() noexcept -> void
+{
+    if (const auto actor{actor_.lock()})
+    {
+        CoroutineAccess::ReportFailure(*actor, std::current_exception(), message_);
+    }
+}
+
+ResumeCoroutine::~ResumeCoroutine()
+{
+    if (handle)
+    {
+        handle.destroy();
+    }
+}
+
+auto ResumeCoroutine::Resume() -> void
+{
+    std::exchange(handle, nullptr).resume();
+}
+
+auto ActorAwaiter::Suspend(const std::coroutine_handle<> handle) -> bool
+{
+    auto *actor{CoroutineAccess::GetCurrentActor()};
+    if (actor == nullptr)
+    {
+        return false;
+    }
+    actor_ = actor->weak_from_this();
+    handle_ = handle;
+    return true;
+}
+
+auto ActorAwaiter::Resume() -> void
+{
+    // The awaiter lives in the coroutine frame, nothing may touch it after the frame is handed over
+    const auto handle{handle_};
+    if (const auto actor{actor_.lock()})
+    {
+        actor->Receive(MakeMessage<ResumeCoroutine>(handle));
+        return;
+    }
+    handle.destroy();
+}
+
+auto ActorAwaiter::GetSystem() const -> Sptr<ActorSystemFacade>
+{
+    const auto actor{actor_.lock()};
+    return actor ? CoroutineAccess::GetSystem(*actor) : nullptr;
+}
+
+SleepAwaiter::SleepAwaiter(const std::chrono::steady_clock::duration delay) : delay_{delay}
+{
+}
+
+auto SleepAwaiter::await_ready() const -> bool
+{
+    return delay_ <= std::chrono::steady_clock::duration::zero();
+}
+
+auto SleepAwaiter::await_suspend(const std::coroutine_handle<> handle) -> bool
+{
+    if (!Suspend(handle))
+    {
+        return false;
+    }
+    const auto system{GetSystem()};
+    return system && system->ScheduleCallback(delay_, [this] { Resume(); });
+}
+
+auto Sleep(const std::chrono::steady_clock::duration delay) -> SleepAwaiter
+{
+    return SleepAwaiter{delay};
+}
+
+} // namespace oxherdcpp
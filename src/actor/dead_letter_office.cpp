@@ -0,0 +1,48 @@
+#include <oxherdcpp/actor/dead_letter_office.h>
+
+#include <oxherdcpp/logger/logger.h>
+
+namespace oxherdcpp
+{
+
+DeadLetterOffice::DeadLetterOffice(const Executor &executor, const std::string &name, const ActorId actor_id)
+    : Actor{executor, name, actor_id}
+{
+    GetMessageDispatcher()
+        .RegisterHandler<DeadLetter>([this](const auto &msg) { HandleDeadLetter(msg); })
+        .RegisterHandler<SubscribeDeadLettersMessage>([this](const auto &msg) { HandleSubscribe(msg); });
+}
+
+auto DeadLetterOffice::GetDeadLetterCount() const -> std::size_t
+{
+    return dead_letter_count_.load(std::memory_order_relaxed);
+}
+
+auto DeadLetterOffice::Behaviour(const MPtr<BaseMessage> &message) -> void
+{
+    GetMessageDispatcher().Dispatch(message);
+}
+
+auto DeadLetterOffice::HandleDeadLetter(const MPtr<DeadLetter> &message) -> void
+{
+    dead_letter_count_.fetch_add(1, std::memory_order_relaxed);
+    LOG_DEBUG("Dead letter for actor ", message->recipient)
+        .AddContext("reason", std::to_string(static_cast<int>(message->reason)));
+
+    for (auto &subscriber : subscribers_)
+    {
+        subscriber.Tell(message);
+    }
+}
+
+auto DeadLetterOffice::HandleSubscribe(const MPtr<SubscribeDeadLettersMessage> &message) -> void
+{
+    subscribers_.push_back(message->subscriber);
+}
+
+auto DeadLetterOffice::OnTerminate() -> void
+{
+    subscribers_.clear();
+}
+
+} // namespace oxherdcpp
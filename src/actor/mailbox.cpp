@@ -0,0 +1,165 @@
+#include <oxherdcpp/actor/mailbox.h>
+
+#include <algorithm>
+
+namespace oxherdcpp
+{
+
+auto Mailbox::Configure(const MailboxConfig &config) -> void
+{
+    config_ = config;
+}
+
+auto Mailbox::Enqueue(MPtr<BaseMessage> message) -> EnqueueResult
+{
+    if (message->IsSystemMessage())
+    {
+        system_queue_.Push(std::move(message));
+        return EnqueueResult{.accepted = true, .needs_schedule = TrySchedule()};
+    }
+    if (!TryReserve())
+    {
+        switch (config_.overflow_policy)
+        {
+        case OverflowPolicy::BlockProducer:
+            if (WaitForCapacity())
+            {
+                break;
+            }
+            [[fallthrough]];
+        case OverflowPolicy::RejectToDeadLetters:
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return EnqueueResult{.rejected = std::move(message)};
+        case OverflowPolicy::DropNewest:
+        case OverflowPolicy::DropOldest:
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return EnqueueResult{};
+        }
+    }
+    queue_.Push(std::move(message));
+    return EnqueueResult{.accepted = true, .needs_schedule = TrySchedule()};
+}
+
+auto Mailbox::EnqueueBatch(std::span<MPtr<BaseMessage>> messages) -> bool
+{
+    if (messages.empty())
+    {
+        return false;
+    }
+    if (std::ranges::any_of(messages, [](const MPtr<BaseMessage> &message) { return message->IsSystemMessage(); }))
+    {
+        for (auto &message : messages)
+        {
+            if (message->IsSystemMessage())
+            {
+                system_queue_.Push(std::move(message));
+                continue;
+            }
+            size_.fetch_add(1, std::memory_order_seq_cst);
+            queue_.Push(std::move(message));
+        }
+        return TrySchedule();
+    }
+    size_.fetch_add(messages.size(), std::memory_order_seq_cst);
+    queue_.PushBatch(std::make_move_iterator(messages.begin()), std::make_move_iterator(messages.end()));
+    return TrySchedule();
+}
+
+auto Mailbox::CanEnqueueBatch() const -> bool
+{
+    return config_.capacity == 0;
+}
+
+auto Mailbox::Dequeue() -> MPtr<BaseMessage>
+{
+    if (auto system_message{system_queue_.TryPop()})
+    {
+        return std::move(*system_message);
+    }
+    const bool drop_oldest{config_.capacity > 0 && config_.overflow_policy == OverflowPolicy::DropOldest};
+    while (true)
+    {
+        auto message{queue_.TryPop()};
+        if (!message)
+        {
+            return nullptr;
+        }
+        const auto previous_size{size_.fetch_sub(1, std::memory_order_seq_cst)};
+        NotifyBlockedProducers();
+        if (drop_oldest && previous_size > config_.capacity)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        return std::move(*message);
+    }
+}
+
+auto Mailbox::CompleteTurn() -> bool
+{
+    scheduled_.store(false, std::memory_order_seq_cst);
+    return (!system_queue_.IsEmpty() || !queue_.IsEmpty()) && TrySchedule();
+}
+
+auto Mailbox::IsScheduled() const -> bool
+{
+    return scheduled_.load(std::memory_order_acquire);
+}
+
+auto Mailbox::GetSize() const -> std::size_t
+{
+    return size_.load(std::memory_order_relaxed);
+}
+
+auto Mailbox::GetDroppedCount() const -> std::size_t
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+auto Mailbox::GetConfig() const -> const MailboxConfig &
+{
+    return config_;
+}
+
+auto Mailbox::TrySchedule() -> bool
+{
+    return !scheduled_.exchange(true, std::memory_order_seq_cst);
+}
+
+auto Mailbox::TryReserve() -> bool
+{
+    // DropOldest accepts past capacity and lets the consumer discard the surplus, but only up to a hard cap,
+    // so a stalled consumer cannot make the queue grow without bound
+    const auto limit{config_.overflow_policy == OverflowPolicy::DropOldest ? config_.capacity * kDropOldestHardCapFactor
+                                                                           : config_.capacity};
+    const auto previous_size{size_.fetch_add(1, std::memory_order_seq_cst)};
+    if (config_.capacity == 0 || previous_size < limit)
+    {
+        return true;
+    }
+    size_.fetch_sub(1, std::memory_order_seq_cst);
+    return false;
+}
+
+auto Mailbox::WaitForCapacity() -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + config_.block_timeout};
+
+    std::unique_lock lock{capacity_mutex_};
+    blocked_producers_.fetch_add(1, std::memory_order_seq_cst);
+    const bool reserved{capacity_available_.wait_until(lock, deadline, [this] { return TryReserve(); })};
+    blocked_producers_.fetch_sub(1, std::memory_order_seq_cst);
+    return reserved;
+}
+
+auto Mailbox::NotifyBlockedProducers() -> void
+{
+    if (blocked_producers_.load(std::memory_order_seq_cst) == 0)
+    {
+        return;
+    }
+    std::lock_guard lock{capacity_mutex_};
+    capacity_available_.notify_one();
+}
+
+} // namespace oxherdcpp
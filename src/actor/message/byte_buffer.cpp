@@ -0,0 +1,234 @@
+#include <oxherdcpp/actor/message/byte_buffer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <oxherdcpp/actor/message/object_pool.h>
+
+namespace oxherdcpp
+{
+
+namespace
+{
+using BlockPools = std::array<CachedPool, kByteBlockSizeClasses.size()>;
+using BlockThreadCaches = std::array<PoolThreadCache, kByteBlockSizeClasses.size()>;
+
+// Blocks of a size class come from one pool, listed in the pool inventory under the class. The pools are
+// never destroyed: thread caches of threads that outlive static destruction still drain into them.
+auto GetBlockPools() -> BlockPools &
+{
+    static auto &pools{*new BlockPools{{
+        {sizeof(ByteBlock) + kByteBlockSizeClasses[0], alignof(std::max_align_t), "oxherdcpp::ByteBlock<256>"},
+        {sizeof(ByteBlock) + kByteBlockSizeClasses[1], alignof(std::max_align_t), "oxherdcpp::ByteBlock<1024>"},
+        {sizeof(ByteBlock) + kByteBlockSizeClasses[2], alignof(std::max_align_t), "oxherdcpp::ByteBlock<4096>"},
+        {sizeof(ByteBlock) + kByteBlockSizeClasses[3], alignof(std::max_align_t), "oxherdcpp::ByteBlock<16384>"},
+    }}};
+    return pools;
+}
+
+auto GetBlockThreadCaches() -> BlockThreadCaches &
+{
+    auto &pools{GetBlockPools()};
+    thread_local BlockThreadCaches caches{PoolThreadCache{pools[0]}, PoolThreadCache{pools[1]},
+                                          PoolThreadCache{pools[2]}, PoolThreadCache{pools[3]}};
+    return caches;
+}
+
+auto FindSizeClass(const std::size_t capacity) -> std::uint32_t
+{
+    const auto found{std::ranges::lower_bound(kByteBlockSizeClasses, capacity)};
+    return static_cast<std::uint32_t>(found - kByteBlockSizeClasses.begin());
+}
+
+// Clamps length to the bytes left past offset
+auto CheckSlice(const std::size_t size, const std::size_t offset, const std::size_t length) -> std::size_t
+{
+    if (offset > size)
+    {
+        throw std::out_of_range{"Slice offset is past the end of the buffer"};
+    }
+    return std::min(length, size - offset);
+}
+} // namespace
+
+auto ByteBlock::Allocate(const std::size_t capacity) -> boost::intrusive_ptr<ByteBlock>
+{
+    const auto size_class{FindSizeClass(capacity)};
+    void *memory{nullptr};
+    if (size_class == kUnpooled)
+    {
+        memory = ::operator new(sizeof(ByteBlock) + capacity);
+    }
+    else
+    {
+        memory = GetBlockPools()[size_class].Allocate(GetBlockThreadCaches()[size_class]);
+    }
+    return boost::intrusive_ptr<ByteBlock>{::new (memory) ByteBlock{
+        .size_class = size_class,
+        .capacity = size_class == kUnpooled ? capacity : kByteBlockSizeClasses[size_class]}};
+}
+
+auto ByteBlock::Free(ByteBlock *block) noexcept -> void
+{
+    const auto size_class{block->size_class};
+    const auto capacity{block->capacity};
+    block->~ByteBlock();
+    if (size_class == kUnpooled)
+    {
+        ::operator delete(block, sizeof(ByteBlock) + capacity);
+        return;
+    }
+    GetBlockPools()[size_class].Deallocate(GetBlockThreadCaches()[size_class], block);
+}
+
+ByteBuffer::ByteBuffer(boost::intrusive_ptr<ByteBlock> block, const std::byte *data, const std::size_t size) noexcept
+    : block_{std::move(block)}, data_{data}, size_{size}
+{
+}
+
+auto ByteBuffer::Copy(const std::span<const std::byte> bytes) -> ByteBuffer
+{
+    if (bytes.empty())
+    {
+        return {};
+    }
+    return Build(bytes.size(), [bytes](const std::span<std::byte> destination) {
+        std::ranges::copy(bytes, destination.begin());
+    });
+}
+
+auto ByteBuffer::Copy(const std::string_view text) -> ByteBuffer
+{
+    return Copy(std::as_bytes(std::span{text}));
+}
+
+auto ByteBuffer::Slice(const std::size_t offset, const std::size_t length) const -> ByteBuffer
+{
+    const auto clamped{CheckSlice(size_, offset, length)};
+    // An empty slice keeps no block alive
+    if (clamped == 0)
+    {
+        return {};
+    }
+    return ByteBuffer{block_, data_ + offset, clamped};
+}
+
+auto ByteBuffer::GetUseCount() const noexcept -> std::uint32_t
+{
+    return block_ ? block_->ref_count.load(std::memory_order_relaxed) : 0;
+}
+
+auto operator==(const ByteBuffer &lhs, const ByteBuffer &rhs) noexcept -> bool
+{
+    return std::ranges::equal(lhs.GetBytes(), rhs.GetBytes());
+}
+
+ByteChain::ByteChain(ByteBuffer buffer)
+{
+    Append(std::move(buffer));
+}
+
+auto ByteChain::Append(ByteBuffer buffer) -> ByteChain &
+{
+    if (!buffer.IsEmpty())
+    {
+        size_ += buffer.GetSize();
+        segments_.push_back(std::move(buffer));
+    }
+    return *this;
+}
+
+auto ByteChain::Append(const ByteChain &chain) -> ByteChain &
+{
+    // Appending a chain to itself must not read segments_ while it grows
+    const auto segments{chain.segments_};
+    segments_.insert(segments_.end(), segments.begin(), segments.end());
+    size_ += chain.size_;
+    return *this;
+}
+
+auto ByteChain::Slice(std::size_t offset, const std::size_t length) const -> ByteChain
+{
+    auto remaining{CheckSlice(size_, offset, length)};
+    ByteChain slice;
+    for (const auto &segment : segments_)
+    {
+        if (remaining == 0)
+        {
+            break;
+        }
+        if (offset >= segment.GetSize())
+        {
+            offset -= segment.GetSize();
+            continue;
+        }
+        const auto piece{std::min(remaining, segment.GetSize() - offset)};
+        slice.Append(segment.Slice(offset, piece));
+        remaining -= piece;
+        offset = 0;
+    }
+    return slice;
+}
+
+auto ByteChain::CopyTo(const std::span<std::byte> destination) const noexcept -> std::size_t
+{
+    std::size_t copied{0};
+    for (const auto &segment : segments_)
+    {
+        if (copied == destination.size())
+        {
+            break;
+        }
+        const auto piece{std::min(segment.GetSize(), destination.size() - copied)};
+        std::memcpy(destination.data() + copied, segment.GetData(), piece);
+        copied += piece;
+    }
+    return copied;
+}
+
+auto ByteChain::Flatten() const -> ByteBuffer
+{
+    if (segments_.size() <= 1)
+    {
+        return segments_.empty() ? ByteBuffer{} : segments_.front();
+    }
+    return ByteBuffer::Build(size_, [this](const std::span<std::byte> destination) { CopyTo(destination); });
+}
+
+auto operator==(const ByteChain &lhs, const ByteChain &rhs) noexcept -> bool
+{
+    if (lhs.size_ != rhs.size_)
+    {
+        return false;
+    }
+    // Segment boundaries may differ, so walk both chains byte run by byte run
+    auto lhs_segment{lhs.segments_.begin()};
+    auto rhs_segment{rhs.segments_.begin()};
+    std::size_t lhs_offset{0};
+    std::size_t rhs_offset{0};
+    while (lhs_segment != lhs.segments_.end() && rhs_segment != rhs.segments_.end())
+    {
+        const auto piece{std::min(lhs_segment->GetSize() - lhs_offset, rhs_segment->GetSize() - rhs_offset)};
+        if (std::memcmp(lhs_segment->GetData() + lhs_offset, rhs_segment->GetData() + rhs_offset, piece) != 0)
+        {
+            return false;
+        }
+        lhs_offset += piece;
+        rhs_offset += piece;
+        if (lhs_offset == lhs_segment->GetSize())
+        {
+            ++lhs_segment;
+            lhs_offset = 0;
+        }
+        if (rhs_offset == rhs_segment->GetSize())
+        {
+            ++rhs_segment;
+            rhs_offset = 0;
+        }
+    }
+    return true;
+}
+
+} // namespace oxherdcpp
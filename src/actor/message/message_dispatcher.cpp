@@ -5,9 +5,9 @@ namespace oxherdcpp
 
 auto MessageDispatcher::Dispatch(const MPtr<BaseMessage> &message) -> void
 {
-    if (const auto found_it{handlers_.find(message->GetTypeId())}; found_it != handlers_.end())
+    if (const auto type_index{message->GetTypeIndex()}; type_index < handlers_.size() && handlers_[type_index])
     {
-        found_it->second(message);
+        handlers_[type_index](message);
     }
 }
 } // namespace oxherdcpp
\ No newline at end of file
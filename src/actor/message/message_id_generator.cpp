@@ -0,0 +1,22 @@
+#include <oxherdcpp/actor/message/message_id_generator.h>
+
+#include <atomic>
+
+namespace oxherdcpp
+{
+namespace
+{
+std::atomic<MessageTypeIndex> message_type_count{0};
+} // namespace
+
+auto AllocateMessageTypeIndex() -> MessageTypeIndex
+{
+    return message_type_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto GetMessageTypeCount() -> std::size_t
+{
+    return message_type_count.load(std::memory_order_relaxed);
+}
+
+} // namespace oxherdcpp
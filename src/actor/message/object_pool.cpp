@@ -1,34 +1,523 @@
 #include <oxherdcpp/actor/message/object_pool.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
 namespace oxherdcpp
 {
 
-MonitoredPoolResource::MonitoredPoolResource(memory_resource *upstream) : synchronized_pool_resource{upstream}
+namespace
+{
+// Bit i is set while a thread holds shard index i
+std::atomic<std::uint32_t> leased_shards{0};
+static_assert(kPoolCounterShards <= 32, "leased_shards has a bit per shard");
+
+std::atomic<std::size_t> global_pool_limit{0};
+std::atomic<std::size_t> global_pool_bytes{0};
+
+struct PoolRegistry
+{
+    std::mutex mutex;
+    std::vector<CachedPool *> pools;
+};
+
+// Constructed by the first pool, so it outlives every pool
+auto GetPoolRegistry() -> PoolRegistry &
 {
+    static PoolRegistry registry;
+    return registry;
 }
 
-PoolStats &MonitoredPoolResource::GetStats()
+auto RoundUp(const std::size_t value, const std::size_t alignment) -> std::size_t
 {
-    return stats_;
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Counts bytes against the global limit, false when they do not fit
+auto ClaimGlobalBytes(const std::size_t bytes) -> bool
+{
+    const auto limit{global_pool_limit.load(std::memory_order_relaxed)};
+    const auto held{global_pool_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes};
+    if (limit != 0 && held > limit)
+    {
+        global_pool_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+auto ReturnGlobalBytes(const std::size_t bytes) -> void
+{
+    global_pool_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+} // namespace
+
+// Header at the start of every chunk; a block finds its chunk by masking its address with the chunk size
+struct PoolChunk
+{
+    PoolChunk *prev{nullptr};
+    PoolChunk *next{nullptr};
+    PoolChunkList *list{nullptr};
+    PoolFreeBlock *free_head{nullptr};
+    std::size_t free_count{0};
+    std::size_t capacity{0};
+};
+
+namespace
+{
+auto Link(PoolChunkList &list, PoolChunk *chunk) noexcept -> void
+{
+    chunk->list = &list;
+    chunk->prev = nullptr;
+    chunk->next = list.head;
+    if (list.head != nullptr)
+    {
+        list.head->prev = chunk;
+    }
+    list.head = chunk;
+}
+
+auto Unlink(PoolChunk *chunk) noexcept -> void
+{
+    (chunk->prev != nullptr ? chunk->prev->next : chunk->list->head) = chunk->next;
+    if (chunk->next != nullptr)
+    {
+        chunk->next->prev = chunk->prev;
+    }
+    chunk->list = nullptr;
+}
+
+auto MoveTo(PoolChunkList &list, PoolChunk *chunk) noexcept -> void
+{
+    if (chunk->list != &list)
+    {
+        Unlink(chunk);
+        Link(list, chunk);
+    }
+}
+} // namespace
+
+PoolCounters::ShardLease::ShardLease() noexcept : index{kPoolCounterShards}
+{
+    auto leased{leased_shards.load(std::memory_order_relaxed)};
+    for (std::size_t candidate{0}; candidate < kPoolCounterShards;)
+    {
+        const auto bit{std::uint32_t{1} << candidate};
+        if ((leased & bit) != 0)
+        {
+            ++candidate;
+            continue;
+        }
+        // Acquire: see the counts the previous holder of the index stored
+        if (leased_shards.compare_exchange_weak(leased, leased | bit, std::memory_order_acquire,
+                                                std::memory_order_relaxed))
+        {
+            index = candidate;
+            return;
+        }
+    }
 }
 
-const PoolStats &MonitoredPoolResource::GetStats() const
+PoolCounters::ShardLease::~ShardLease()
+{
+    if (index < kPoolCounterShards)
+    {
+        leased_shards.fetch_and(~(std::uint32_t{1} << index), std::memory_order_release);
+    }
+    // Messages freed later in the thread's teardown are counted in the overflow shard
+    index = kPoolCounterShards;
+}
+
+auto PoolCounters::Sum(const Field field) const noexcept -> std::size_t
+{
+    std::size_t sum{0};
+    for (const auto &shard : shards_)
+    {
+        sum += shard.values[static_cast<std::size_t>(field)].load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+PoolCounter::PoolCounter(const PoolCounters &counters, const PoolCounters::Field field) noexcept
+    : counters_{&counters}, field_{field}
+{
+}
+
+auto PoolCounter::load() const noexcept -> std::size_t
+{
+    return counters_->Sum(field_);
+}
+
+PoolStats::PoolStats(const PoolCounters &counters) noexcept
+    : allocations{counters, PoolCounters::Field::Allocations},
+      deallocations{counters, PoolCounters::Field::Deallocations},
+      bytes_allocated{counters, PoolCounters::Field::BytesAllocated},
+      bytes_deallocated{counters, PoolCounters::Field::BytesDeallocated}
+{
+}
+
+PoolThreadCache::PoolThreadCache(CachedPool &pool) noexcept
+    : pool_{&pool}, generation_{pool.generation_.load(std::memory_order_acquire)}
+{
+}
+
+PoolThreadCache::~PoolThreadCache()
+{
+    auto *const pool{pool_};
+    pool_ = nullptr;
+    if (pool != nullptr && pool->generation_.load(std::memory_order_acquire) == generation_)
+    {
+        pool->Drain(*this, size_);
+    }
+}
+
+CachedPool::CachedPool(const std::size_t block_size, const std::size_t alignment, const std::string_view name,
+                       std::pmr::memory_resource *upstream)
+    : name_{name}, object_size_{block_size}, alignment_{std::max(alignment, alignof(PoolFreeBlock))},
+      block_size_{RoundUp(std::max(block_size, sizeof(PoolFreeBlock)), alignment_)},
+      chunk_size_{std::max(kMinPoolChunkBytes,
+                           std::bit_ceil(RoundUp(sizeof(PoolChunk), alignment_) + kMinBlocksPerChunk * block_size_))},
+      first_block_offset_{RoundUp(sizeof(PoolChunk), alignment_)},
+      blocks_per_chunk_{(chunk_size_ - first_block_offset_) / block_size_}, upstream_{upstream}
+{
+    auto &registry{GetPoolRegistry()};
+    std::lock_guard lock{registry.mutex};
+    registry.pools.push_back(this);
+}
+
+CachedPool::~CachedPool()
+{
+    {
+        auto &registry{GetPoolRegistry()};
+        std::lock_guard lock{registry.mutex};
+        std::erase(registry.pools, this);
+    }
+    std::lock_guard lock{mutex_};
+    FreeChunks(partial_chunks_);
+    FreeChunks(empty_chunks_);
+    FreeChunks(full_chunks_);
+    FreeUnpooledBlocks();
+}
+
+auto CachedPool::GetStats() const -> const PoolStats &
 {
     return stats_;
 }
 
-void *MonitoredPoolResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+auto CachedPool::Reserve(const std::size_t block_count) -> bool
 {
-    void *ptr{synchronized_pool_resource::do_allocate(bytes, alignment)};
-    stats_.allocations.fetch_add(1, std::memory_order_relaxed);
-    stats_.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
-    return ptr;
+    std::lock_guard lock{mutex_};
+    const auto reserved_bytes{(block_count + blocks_per_chunk_ - 1) / blocks_per_chunk_ * chunk_size_};
+    reserved_bytes_ = std::max(reserved_bytes_, reserved_bytes);
+    while (held_bytes_ < reserved_bytes)
+    {
+        if (CarveChunk() == nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-void MonitoredPoolResource::do_deallocate(void *ptr, const std::size_t bytes, const std::size_t alignment)
+auto CachedPool::SetLimits(const PoolLimits limits) -> void
 {
-    synchronized_pool_resource::do_deallocate(ptr, bytes, alignment);
-    stats_.deallocations.fetch_add(1, std::memory_order_relaxed);
-    stats_.bytes_deallocated.fetch_add(bytes, std::memory_order_relaxed);
+    std::lock_guard lock{mutex_};
+    limits_ = limits;
 }
-} // namespace oxherdcpp
\ No newline at end of file
+
+auto CachedPool::GetLimits() const -> PoolLimits
+{
+    std::lock_guard lock{mutex_};
+    return limits_;
+}
+
+auto CachedPool::Trim() -> std::size_t
+{
+    std::lock_guard lock{mutex_};
+    std::size_t freed{0};
+    while (empty_chunks_.head != nullptr && held_bytes_ >= reserved_bytes_ + chunk_size_)
+    {
+        FreeChunk(empty_chunks_.head);
+        freed += chunk_size_;
+    }
+    return freed;
+}
+
+auto CachedPool::GetHeldBytes() const -> std::size_t
+{
+    std::lock_guard lock{mutex_};
+    return held_bytes_;
+}
+
+auto CachedPool::GetReport() const -> PoolReport
+{
+    // Deallocations first: read the other way round a concurrent free could make the difference negative
+    const auto deallocations{stats_.deallocations.load()};
+    const auto allocations{stats_.allocations.load()};
+    std::lock_guard lock{mutex_};
+    return {.name = name_,
+            .object_size = object_size_,
+            .block_size = block_size_,
+            .live_objects = allocations - deallocations,
+            .blocks_out = blocks_out_,
+            .unpooled_blocks = unpooled_blocks_.size(),
+            .held_bytes = held_bytes_,
+            .peak_held_bytes = peak_held_bytes_,
+            .reserved_bytes = reserved_bytes_};
+}
+
+auto CachedPool::Release() -> void
+{
+    std::lock_guard lock{mutex_};
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    FreeChunks(partial_chunks_);
+    FreeChunks(empty_chunks_);
+    FreeChunks(full_chunks_);
+    FreeUnpooledBlocks();
+    reserved_bytes_ = 0;
+    blocks_out_ = 0;
+}
+
+auto CachedPool::Refill(PoolThreadCache &cache) -> bool
+{
+    std::lock_guard lock{mutex_};
+    try
+    {
+        while (cache.size_ < kPoolTransferBatch)
+        {
+            auto *const block{TakeShared()};
+            if (block == nullptr)
+            {
+                break;
+            }
+            cache.head_ = ::new (block) PoolFreeBlock{cache.head_};
+            ++cache.size_;
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        if (cache.head_ == nullptr)
+        {
+            throw;
+        }
+    }
+    return cache.head_ != nullptr;
+}
+
+auto CachedPool::Drain(PoolThreadCache &cache, const std::size_t count) noexcept -> void
+{
+    std::lock_guard lock{mutex_};
+    for (std::size_t i{0}; i < count && cache.head_ != nullptr; ++i)
+    {
+        auto *const block{cache.head_};
+        cache.head_ = block->next;
+        --cache.size_;
+        PutShared(block);
+    }
+}
+
+auto CachedPool::AllocateShared() -> void *
+{
+    void *block{nullptr};
+    {
+        std::lock_guard lock{mutex_};
+        block = TakeShared();
+        if (block == nullptr)
+        {
+            if (limits_.on_limit == PoolLimitAction::Throw)
+            {
+                throw std::bad_alloc{};
+            }
+            block = upstream_->allocate(block_size_, alignment_);
+            try
+            {
+                unpooled_blocks_.insert(block);
+            }
+            catch (...)
+            {
+                upstream_->deallocate(block, block_size_, alignment_);
+                throw;
+            }
+            unpooled_count_.store(unpooled_blocks_.size(), std::memory_order_relaxed);
+        }
+    }
+    counters_.RecordAllocation(block_size_);
+    return block;
+}
+
+auto CachedPool::DeallocateShared(void *ptr) noexcept -> void
+{
+    {
+        std::lock_guard lock{mutex_};
+        PutShared(ptr);
+    }
+    counters_.RecordDeallocation(block_size_);
+}
+
+auto CachedPool::DeallocateUnpooled(void *ptr) noexcept -> bool
+{
+    {
+        std::lock_guard lock{mutex_};
+        if (unpooled_blocks_.erase(ptr) == 0)
+        {
+            return false;
+        }
+        unpooled_count_.store(unpooled_blocks_.size(), std::memory_order_relaxed);
+        upstream_->deallocate(ptr, block_size_, alignment_);
+    }
+    counters_.RecordDeallocation(block_size_);
+    return true;
+}
+
+auto CachedPool::TakeShared() -> void *
+{
+    auto *chunk{partial_chunks_.head != nullptr ? partial_chunks_.head : empty_chunks_.head};
+    if (chunk == nullptr)
+    {
+        chunk = CarveChunk();
+    }
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+    ++blocks_out_;
+    auto *const block{chunk->free_head};
+    chunk->free_head = block->next;
+    --chunk->free_count;
+    MoveTo(chunk->free_count == 0 ? full_chunks_ : partial_chunks_, chunk);
+    return block;
+}
+
+auto CachedPool::PutShared(void *ptr) noexcept -> void
+{
+    auto *const chunk{GetChunk(ptr)};
+    --blocks_out_;
+    chunk->free_head = ::new (ptr) PoolFreeBlock{chunk->free_head};
+    ++chunk->free_count;
+    MoveTo(chunk->free_count == chunk->capacity ? empty_chunks_ : partial_chunks_, chunk);
+}
+
+auto CachedPool::CarveChunk() -> PoolChunk *
+{
+    if (limits_.max_bytes != 0 && held_bytes_ + chunk_size_ > limits_.max_bytes)
+    {
+        return nullptr;
+    }
+    if (!ClaimGlobalBytes(chunk_size_))
+    {
+        return nullptr;
+    }
+    void *memory{nullptr};
+    try
+    {
+        memory = upstream_->allocate(chunk_size_, chunk_size_);
+    }
+    catch (...)
+    {
+        ReturnGlobalBytes(chunk_size_);
+        throw;
+    }
+    auto *const chunk{::new (memory) PoolChunk{.capacity = blocks_per_chunk_}};
+    // Linked from the last block down, so blocks are handed out in address order
+    auto *const first_block{static_cast<std::byte *>(memory) + first_block_offset_};
+    for (auto index{blocks_per_chunk_}; index > 0; --index)
+    {
+        chunk->free_head = ::new (first_block + (index - 1) * block_size_) PoolFreeBlock{chunk->free_head};
+    }
+    chunk->free_count = blocks_per_chunk_;
+    Link(empty_chunks_, chunk);
+    held_bytes_ += chunk_size_;
+    peak_held_bytes_ = std::max(peak_held_bytes_, held_bytes_);
+    return chunk;
+}
+
+auto CachedPool::FreeUnpooledBlocks() noexcept -> void
+{
+    for (auto *const block : unpooled_blocks_)
+    {
+        upstream_->deallocate(block, block_size_, alignment_);
+    }
+    unpooled_blocks_.clear();
+    unpooled_count_.store(0, std::memory_order_relaxed);
+}
+
+auto CachedPool::FreeChunk(PoolChunk *chunk) noexcept -> void
+{
+    held_bytes_ -= chunk_size_;
+    ReturnGlobalBytes(chunk_size_);
+    Unlink(chunk);
+    chunk->~PoolChunk();
+    upstream_->deallocate(chunk, chunk_size_, chunk_size_);
+}
+
+auto CachedPool::FreeChunks(PoolChunkList &chunks) noexcept -> void
+{
+    while (chunks.head != nullptr)
+    {
+        FreeChunk(chunks.head);
+    }
+}
+
+auto CachedPool::GetChunk(void *block) const noexcept -> PoolChunk *
+{
+    return reinterpret_cast<PoolChunk *>(reinterpret_cast<std::uintptr_t>(block) & ~(chunk_size_ - 1));
+}
+
+auto SetGlobalPoolLimit(const std::size_t max_bytes) -> void
+{
+    global_pool_limit.store(max_bytes, std::memory_order_relaxed);
+}
+
+auto GetGlobalPoolLimit() -> std::size_t
+{
+    return global_pool_limit.load(std::memory_order_relaxed);
+}
+
+auto GetGlobalPoolBytes() -> std::size_t
+{
+    return global_pool_bytes.load(std::memory_order_relaxed);
+}
+
+auto TrimAllPools() -> std::size_t
+{
+    auto &registry{GetPoolRegistry()};
+    std::lock_guard lock{registry.mutex};
+    std::size_t freed{0};
+    for (auto *const pool : registry.pools)
+    {
+        freed += pool->Trim();
+    }
+    return freed;
+}
+
+auto GetPoolInventory() -> std::vector<PoolReport>
+{
+    auto &registry{GetPoolRegistry()};
+    std::lock_guard lock{registry.mutex};
+    std::vector<PoolReport> reports;
+    reports.reserve(registry.pools.size());
+    for (const auto *const pool : registry.pools)
+    {
+        reports.push_back(pool->GetReport());
+    }
+    return reports;
+}
+
+auto WritePoolInventory(std::ostream &out) -> void
+{
+    auto reports{GetPoolInventory()};
+    std::ranges::sort(reports, std::ranges::greater{}, &PoolReport::held_bytes);
+    for (const auto &report : reports)
+    {
+        out << report.name << ": size=" << report.object_size << " block=" << report.block_size
+            << " live=" << report.live_objects << " out=" << report.blocks_out
+            << " unpooled=" << report.unpooled_blocks << " held=" << report.held_bytes
+            << " peak=" << report.peak_held_bytes << " reserved=" << report.reserved_bytes << '\n';
+    }
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,256 @@
+#include <oxherdcpp/actor/router.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_system_facade.h>
+#include <oxherdcpp/actor/events.h>
+
+namespace oxherdcpp
+{
+namespace
+{
+// splitmix64 finalizer, spreads sequential keys and ring points over the whole ring
+auto Mix(std::uint64_t value) -> std::size_t
+{
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27U)) * 0x94d049bb133111ebULL;
+    return static_cast<std::size_t>(value ^ (value >> 31U));
+}
+
+auto NextRandom() -> std::size_t
+{
+    thread_local std::minstd_rand engine{std::random_device{}()};
+    return engine();
+}
+} // namespace
+
+RoutingLogic::RoutingLogic(RouterConfig config)
+    : config_{std::move(config)}, routees_{MakeSptr<const Routees>(config_.routee_count)}
+{
+    if (config_.routee_count == 0)
+    {
+        throw std::invalid_argument{"Router needs at least one routee"};
+    }
+    if (config_.strategy != RoutingStrategy::ConsistentHash)
+    {
+        return;
+    }
+    if (!config_.hash_key)
+    {
+        throw std::invalid_argument{"ConsistentHash router needs a hash_key"};
+    }
+    const auto virtual_nodes{std::max<std::size_t>(config_.virtual_nodes, 1)};
+    ring_.reserve(config_.routee_count * virtual_nodes);
+    for (std::size_t index{0}; index < config_.routee_count; ++index)
+    {
+        for (std::size_t node{0}; node < virtual_nodes; ++node)
+        {
+            ring_.emplace_back(Mix((static_cast<std::uint64_t>(index) << 32U) | node), index);
+        }
+    }
+    std::ranges::sort(ring_);
+}
+
+auto RoutingLogic::Route(MPtr<BaseMessage> message) -> RouteResult
+{
+    // The snapshot keeps every routee in it alive while the message is handed over
+    const auto routees{routees_.load(std::memory_order_acquire)};
+    auto *const routee{Select(*routees, *message)};
+    if (routee == nullptr)
+    {
+        return RouteResult{.unrouted = std::move(message)};
+    }
+    return RouteResult{.accepted = routee->TryReceive(std::move(message))};
+}
+
+auto RoutingLogic::SetRoutee(const std::size_t index, Sptr<Actor> routee) -> void
+{
+    auto routees{MakeSptr<Routees>(*routees_.load(std::memory_order_acquire))};
+    routees->at(index) = std::move(routee);
+    routees_.store(std::move(routees), std::memory_order_release);
+}
+
+auto RoutingLogic::FindRoutee(const ActorId routee_id) const -> std::optional<std::size_t>
+{
+    const auto routees{routees_.load(std::memory_order_acquire)};
+    const auto routee_it{std::ranges::find_if(
+        *routees, [routee_id](const Sptr<Actor> &routee) { return routee && routee->GetId() == routee_id; })};
+    if (routee_it == routees->end())
+    {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(routee_it - routees->begin());
+}
+
+auto RoutingLogic::GetRouteeCount() const -> std::size_t
+{
+    const auto routees{routees_.load(std::memory_order_acquire)};
+    return static_cast<std::size_t>(std::ranges::count_if(*routees, [](const Sptr<Actor> &routee) {
+        return routee != nullptr;
+    }));
+}
+
+auto RoutingLogic::GetConfig() const -> const RouterConfig &
+{
+    return config_;
+}
+
+auto RoutingLogic::Select(const Routees &routees, const BaseMessage &message) -> Actor *
+{
+    switch (config_.strategy)
+    {
+    case RoutingStrategy::RoundRobin:
+        return SelectFrom(routees, next_.fetch_add(1, std::memory_order_relaxed) % routees.size());
+    case RoutingStrategy::Random:
+        return SelectFrom(routees, NextRandom() % routees.size());
+    case RoutingStrategy::ConsistentHash:
+        return SelectConsistentHash(routees, message);
+    case RoutingStrategy::SmallestMailbox:
+        return SelectSmallestMailbox(routees);
+    }
+    return nullptr;
+}
+
+auto RoutingLogic::SelectFrom(const Routees &routees, const std::size_t start) -> Actor *
+{
+    for (std::size_t offset{0}; offset < routees.size(); ++offset)
+    {
+        if (const auto &routee{routees[(start + offset) % routees.size()]})
+        {
+            return routee.get();
+        }
+    }
+    return nullptr;
+}
+
+auto RoutingLogic::SelectSmallestMailbox(const Routees &routees) -> Actor *
+{
+    Actor *selected{nullptr};
+    auto selected_score{std::numeric_limits<std::size_t>::max()};
+    for (const auto &routee : routees)
+    {
+        if (routee == nullptr)
+        {
+            continue;
+        }
+        const auto &mailbox{routee->GetMailbox()};
+        const auto score{mailbox.GetSize() * 2 + (mailbox.IsScheduled() ? 1 : 0)};
+        if (score < selected_score)
+        {
+            selected = routee.get();
+            selected_score = score;
+        }
+        if (score == 0)
+        {
+            break;
+        }
+    }
+    return selected;
+}
+
+auto RoutingLogic::SelectConsistentHash(const Routees &routees, const BaseMessage &message) const -> Actor *
+{
+    const auto key{Mix(config_.hash_key(message))};
+    const auto point_it{std::ranges::lower_bound(ring_, key, {}, &std::pair<std::size_t, std::size_t>::first)};
+    const auto start{static_cast<std::size_t>(point_it - ring_.begin())};
+    // A routee that left routing hands its keys to the next point on the ring
+    for (std::size_t offset{0}; offset < ring_.size(); ++offset)
+    {
+        if (const auto &routee{routees[ring_[(start + offset) % ring_.size()].second]})
+        {
+            return routee.get();
+        }
+    }
+    return nullptr;
+}
+
+Router::Router(Sptr<RoutingLogic> logic, const ActorId router_id, Wptr<ActorSystemFacade> system_facade)
+    : logic_{std::move(logic)}, router_id_{router_id}, system_facade_{std::move(system_facade)}
+{
+}
+
+auto Router::Tell(MPtr<BaseMessage> message) noexcept -> void
+{
+    (void)TryTell(std::move(message));
+}
+
+auto Router::TryTell(MPtr<BaseMessage> message) noexcept -> bool
+{
+    auto [accepted, unrouted]{logic_->Route(std::move(message))};
+    if (unrouted)
+    {
+        if (const auto facade{system_facade_.lock()})
+        {
+            facade->PublishDeadLetter(
+                MakeMessage<DeadLetter>(router_id_, std::move(unrouted), DeadLetterReason::NoRoutee));
+        }
+    }
+    return accepted;
+}
+
+auto Router::GetRouteeCount() const -> std::size_t
+{
+    return logic_->GetRouteeCount();
+}
+
+auto Router::GetId() const noexcept -> ActorId
+{
+    return router_id_;
+}
+
+RouterActor::RouterActor(const Executor &executor, const std::string &name, const ActorId actor_id,
+                         RouterConfig config, RouteeFactory factory)
+    : Actor(executor, name, actor_id), factory_{std::move(factory)},
+      logic_{MakeSptr<RoutingLogic>(std::move(config))}
+{
+}
+
+auto RouterActor::GetRouter() -> Router
+{
+    return Router{logic_, GetId(), GetContext().GetSystem()};
+}
+
+auto RouterActor::OnInitialize() -> void
+{
+    for (std::size_t index{0}; index < logic_->GetConfig().routee_count; ++index)
+    {
+        auto routee{factory_(GetContext(), index)};
+        routee.Tell(MakeMessage<GoStartActor>());
+        logic_->SetRoutee(index, GetContext().GetChild(routee.GetId()));
+    }
+}
+
+auto RouterActor::Behaviour(const MPtr<BaseMessage> &message) -> void
+{
+    if (const auto failure_event{Cast<ActorFailureEvent>(message)})
+    {
+        HandleRouteeFailure(failure_event);
+        return;
+    }
+    GetRouter().Tell(message);
+}
+
+auto RouterActor::HandleRouteeFailure(const MPtr<ActorFailureEvent> &failure_event) -> void
+{
+    const auto index{logic_->FindRoutee(failure_event->actor_id)};
+    const auto directive{GetContext().HandleChildFailure(failure_event)};
+    if (!index)
+    {
+        return;
+    }
+    if (directive == Directive::Restart)
+    {
+        logic_->SetRoutee(*index, GetContext().GetChild(failure_event->actor_id));
+    }
+    else if (directive == Directive::Stop)
+    {
+        logic_->SetRoutee(*index, nullptr);
+    }
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,103 @@
+#include <oxherdcpp/actor/scheduler/dispatcher.h>
+
+namespace oxherdcpp
+{
+
+Dispatcher::Dispatcher(DispatcherConfig config) : config_{std::move(config)}
+{
+    config_.thread_count = std::max<std::size_t>(config_.thread_count, 1);
+}
+
+Dispatcher::~Dispatcher()
+{
+    Stop();
+}
+
+auto Dispatcher::AcquireExecutor() -> boost::asio::any_io_executor
+{
+    std::lock_guard lock{mutex_};
+    if (config_.kind == DispatcherKind::PinnedThread)
+    {
+        return LaneExecutor{MakeSptr<LaneLease>(LeaseLane())};
+    }
+    if (lanes_.empty())
+    {
+        StartLane(config_.thread_count);
+    }
+    return lanes_.front()->context.get_executor();
+}
+
+auto Dispatcher::GetConfig() const -> const DispatcherConfig &
+{
+    return config_;
+}
+
+auto Dispatcher::GetThreadCount() const -> std::size_t
+{
+    std::lock_guard lock{mutex_};
+    return thread_count_;
+}
+
+auto Dispatcher::Stop() -> void
+{
+    std::vector<Sptr<Lane>> lanes;
+    {
+        std::lock_guard lock{mutex_};
+        is_stopped_ = true;
+        lanes.swap(lanes_);
+    }
+    for (const auto &lane : lanes)
+    {
+        lane->work_guard.reset();
+    }
+    for (const auto &lane : lanes)
+    {
+        lane->threads.clear();
+        lane->context.stop();
+    }
+    // Actors may still hold executors of these lanes, keep the io_contexts alive until destruction
+    std::lock_guard lock{mutex_};
+    for (auto &lane : lanes)
+    {
+        lanes_.push_back(std::move(lane));
+    }
+}
+
+auto Dispatcher::LeaseLane() -> Sptr<Lane>
+{
+    for (const auto &lane : lanes_)
+    {
+        if (bool expected{false}; lane->is_leased.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            return lane;
+        }
+    }
+    auto lane{StartLane(1)};
+    lane->is_leased.store(true, std::memory_order_relaxed);
+    return lane;
+}
+
+auto Dispatcher::StartLane(const std::size_t thread_count) -> Sptr<Lane>
+{
+    auto shared_lane{lanes_.emplace_back(MakeSptr<Lane>(thread_count == 1 ? 1 : BOOST_ASIO_CONCURRENCY_HINT_DEFAULT))};
+    auto &lane{*shared_lane};
+    if (is_stopped_)
+    {
+        // A stopped dispatcher hands out executors whose work never runs, like a stopped io_context
+        lane.work_guard.reset();
+        return shared_lane;
+    }
+    const auto cpu_sets{ResolveWorkerCpuSets(config_.affinity, thread_count_ + thread_count)};
+    for (std::size_t i{0}; i < thread_count; ++i)
+    {
+        const auto worker{thread_count_ + i};
+        lane.threads.emplace_back([&context = lane.context, worker, cpus = cpu_sets[worker]] {
+            PinWorkerThread(worker, cpus);
+            context.run();
+        });
+    }
+    thread_count_ += thread_count;
+    return shared_lane;
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,88 @@
+#include <oxherdcpp/actor/scheduler/idle_strategy.h>
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace oxherdcpp
+{
+namespace
+{
+// Tells the core we are spinning, so a hyperthread sibling gets the pipeline and leaving the loop does
+// not pay for a memory order violation.
+auto CpuRelax() noexcept -> void
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+} // namespace
+
+IdleBackoff::IdleBackoff(const IdleStrategy &strategy, IdleCounters &counters)
+    : strategy_{strategy}, counters_{counters}
+{
+}
+
+auto IdleBackoff::Idle() -> bool
+{
+    const auto poll{idle_polls_++};
+    switch (strategy_.kind)
+    {
+    case IdleStrategyKind::Block:
+        break;
+    case IdleStrategyKind::Spin:
+        if (poll < strategy_.spin_count)
+        {
+            CpuRelax();
+            return false;
+        }
+        break;
+    case IdleStrategyKind::SpinYieldPark:
+        if (poll < strategy_.spin_count)
+        {
+            CpuRelax();
+            return false;
+        }
+        if (poll < strategy_.spin_count + strategy_.yield_count)
+        {
+            std::this_thread::yield();
+            return false;
+        }
+        break;
+    case IdleStrategyKind::BusyPoll:
+        CpuRelax();
+        return false;
+    }
+    idle_polls_ = 0;
+    counters_.parks.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+auto RunIoContext(boost::asio::io_context &context, const IdleStrategy &strategy, IdleCounters &counters) -> void
+{
+    if (strategy.kind == IdleStrategyKind::Block)
+    {
+        context.run();
+        return;
+    }
+    IdleBackoff backoff{strategy, counters};
+    while (!context.stopped())
+    {
+        if (context.poll() > 0)
+        {
+            backoff.Busy();
+            continue;
+        }
+        // poll stops the io_context once it has no work left at all
+        if (!context.stopped() && backoff.Idle())
+        {
+            context.run_one();
+        }
+    }
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,158 @@
+#include <oxherdcpp/actor/scheduler/sharded_runtime.h>
+
+namespace oxherdcpp
+{
+namespace
+{
+thread_local const ShardedRuntime *current_runtime{nullptr};
+thread_local std::size_t current_shard{0};
+} // namespace
+
+ShardedRuntime::ShardedRuntime(const std::size_t shard_count, std::vector<CpuSet> shard_cpus,
+                               const IdleStrategy idle_strategy)
+    : idle_strategy_{idle_strategy}
+{
+    const auto count{std::max<std::size_t>(shard_count, 1)};
+    shards_.reserve(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        auto shard{MakeUptr<Shard>(count)};
+        for (std::size_t source{0}; source < count; ++source)
+        {
+            if (source != i)
+            {
+                shard->inbound[source] = MakeUptr<Ring>();
+            }
+        }
+        shard->work_guard.emplace(shard->context.get_executor());
+        shards_.push_back(std::move(shard));
+    }
+    shard_cpus.resize(count);
+    threads_.reserve(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        threads_.emplace_back([this, i, cpus = std::move(shard_cpus[i])] {
+            PinWorkerThread(i, cpus);
+            current_runtime = this;
+            current_shard = i;
+            RunIoContext(shards_[i]->context, idle_strategy_, idle_counters_);
+            current_runtime = nullptr;
+        });
+    }
+    is_running_ = true;
+}
+
+ShardedRuntime::~ShardedRuntime()
+{
+    Stop();
+    DestroyPendingTasks();
+}
+
+auto ShardedRuntime::GetExecutor(const std::size_t shard) -> executor_type
+{
+    return executor_type{*this, shard % shards_.size()};
+}
+
+auto ShardedRuntime::GetShardCount() const -> std::size_t
+{
+    return shards_.size();
+}
+
+auto ShardedRuntime::GetCurrentShard() const -> std::optional<std::size_t>
+{
+    if (current_runtime != this)
+    {
+        return std::nullopt;
+    }
+    return current_shard;
+}
+
+auto ShardedRuntime::GetCrossShardCount() const -> std::size_t
+{
+    return cross_shard_count_.load(std::memory_order_relaxed);
+}
+
+auto ShardedRuntime::GetIdleStats() const -> IdleStats
+{
+    return idle_counters_.GetStats();
+}
+
+auto ShardedRuntime::Stop() -> void
+{
+    if (!is_running_.exchange(false))
+    {
+        return;
+    }
+    for (const auto &shard : shards_)
+    {
+        shard->work_guard.reset();
+    }
+    threads_.clear();
+    for (const auto &shard : shards_)
+    {
+        shard->context.stop();
+    }
+}
+
+auto ShardedRuntime::WakeShard(const std::size_t shard) -> void
+{
+    // Pairs with the fence in Drain: either the drain sees our task or we see the flag cleared
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (shards_[shard]->drain_pending.exchange(true, std::memory_order_seq_cst))
+    {
+        return;
+    }
+    ExecuteLocal(shard, false, [this, shard] { Drain(shard); });
+}
+
+auto ShardedRuntime::Drain(const std::size_t shard) -> void
+{
+    auto &destination{*shards_[shard]};
+    destination.drain_pending.store(false, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool has_leftovers{false};
+    for (const auto &ring : destination.inbound)
+    {
+        if (ring == nullptr)
+        {
+            continue;
+        }
+        // One ring's worth per source, so a flooding shard cannot keep this drain going forever
+        std::size_t drained{0};
+        for (; drained < kRingCapacity; ++drained)
+        {
+            const auto task{ring->TryPop()};
+            if (!task)
+            {
+                break;
+            }
+            const Uptr<SchedulerTask> owned{*task};
+            owned->Run();
+        }
+        has_leftovers = has_leftovers || drained == kRingCapacity;
+    }
+    if (has_leftovers)
+    {
+        WakeShard(shard);
+    }
+}
+
+auto ShardedRuntime::DestroyPendingTasks() -> void
+{
+    for (const auto &shard : shards_)
+    {
+        for (const auto &ring : shard->inbound)
+        {
+            if (ring == nullptr)
+            {
+                continue;
+            }
+            while (const auto task{ring->TryPop()})
+            {
+                delete *task;
+            }
+        }
+    }
+}
+
+} // namespace oxherdcpp
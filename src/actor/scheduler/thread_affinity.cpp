@@ -0,0 +1,258 @@
+#include <oxherdcpp/actor/scheduler/thread_affinity.h>
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <oxherdcpp/logger/logger.h>
+
+namespace oxherdcpp
+{
+namespace
+{
+auto ParseNumber(const std::string_view text, std::size_t &value) -> bool
+{
+    const auto *end{text.data() + text.size()};
+    const auto [ptr, error]{std::from_chars(text.data(), end, value)};
+    return error == std::errc{} && ptr == end;
+}
+
+auto Trim(std::string_view text) -> std::string_view
+{
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\n'))
+    {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\n'))
+    {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+auto AllCpus() -> CpuSet
+{
+    CpuSet cpus(std::max(1u, std::thread::hardware_concurrency()));
+    for (std::size_t i{0}; i < cpus.size(); ++i)
+    {
+        cpus[i] = i;
+    }
+    return cpus;
+}
+
+// CPUs the process may run on, e.g. as narrowed by taskset or a cgroup cpuset. Every CPU when unknown.
+auto GetProcessAffinity() -> CpuSet
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        CpuSet cpus;
+        for (std::size_t cpu{0}; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (CPU_ISSET(cpu, &set))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+#endif
+    return AllCpus();
+}
+} // namespace
+
+auto ParseCpuList(std::string_view list) -> CpuSet
+{
+    CpuSet cpus;
+    while (!list.empty())
+    {
+        const auto comma{list.find(',')};
+        const auto part{Trim(list.substr(0, comma))};
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+        std::size_t first{0};
+        std::size_t last{0};
+        if (const auto dash{part.find('-')}; dash == std::string_view::npos)
+        {
+            if (!ParseNumber(part, first))
+            {
+                continue;
+            }
+            last = first;
+        }
+        else if (!ParseNumber(part.substr(0, dash), first) || !ParseNumber(part.substr(dash + 1), last) ||
+                 last < first)
+        {
+            continue;
+        }
+        for (auto cpu{first}; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+auto GetNumaNodes() -> std::vector<NumaNode>
+{
+    std::vector<NumaNode> nodes;
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator{"/sys/devices/system/node", error})
+    {
+        const auto name{entry.path().filename().string()};
+        std::size_t id{0};
+        if (name.rfind("node", 0) != 0 || !ParseNumber(std::string_view{name}.substr(4), id))
+        {
+            continue;
+        }
+        std::ifstream cpulist{entry.path() / "cpulist"};
+        std::string line;
+        std::getline(cpulist, line);
+        if (auto cpus{ParseCpuList(line)}; !cpus.empty())
+        {
+            nodes.push_back(NumaNode{.id = id, .cpus = std::move(cpus)});
+        }
+    }
+    const auto allowed{GetProcessAffinity()};
+    nodes = RestrictNumaNodes(std::move(nodes), allowed);
+    if (nodes.empty())
+    {
+        nodes.push_back(NumaNode{.id = 0, .cpus = allowed});
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const NumaNode &lhs, const NumaNode &rhs) { return lhs.id < rhs.id; });
+    return nodes;
+}
+
+auto RestrictNumaNodes(std::vector<NumaNode> nodes, const CpuSet &allowed) -> std::vector<NumaNode>
+{
+    for (auto &node : nodes)
+    {
+        std::erase_if(node.cpus, [&allowed](const std::size_t cpu) {
+            return !std::binary_search(allowed.begin(), allowed.end(), cpu);
+        });
+    }
+    std::erase_if(nodes, [](const NumaNode &node) { return node.cpus.empty(); });
+    return nodes;
+}
+
+auto ResolveWorkerCpuSets(const WorkerAffinity &affinity, const std::size_t worker_count,
+                          const std::vector<NumaNode> &nodes) -> std::vector<CpuSet>
+{
+    std::vector<CpuSet> result(worker_count);
+    switch (affinity.pinning)
+    {
+    case WorkerPinning::None:
+        break;
+    case WorkerPinning::Explicit:
+        if (!affinity.cpu_sets.empty())
+        {
+            for (std::size_t i{0}; i < worker_count; ++i)
+            {
+                result[i] = affinity.cpu_sets[i % affinity.cpu_sets.size()];
+            }
+        }
+        break;
+    case WorkerPinning::PerCpu: {
+        CpuSet cpus;
+        for (const auto &node : nodes)
+        {
+            cpus.insert(cpus.end(), node.cpus.begin(), node.cpus.end());
+        }
+        if (!cpus.empty())
+        {
+            for (std::size_t i{0}; i < worker_count; ++i)
+            {
+                result[i] = CpuSet{cpus[i % cpus.size()]};
+            }
+        }
+        break;
+    }
+    case WorkerPinning::PerNumaNode:
+        if (!nodes.empty())
+        {
+            for (std::size_t i{0}; i < worker_count; ++i)
+            {
+                result[i] = nodes[i * nodes.size() / worker_count].cpus;
+            }
+        }
+        break;
+    }
+    return result;
+}
+
+auto ResolveWorkerCpuSets(const WorkerAffinity &affinity, const std::size_t worker_count) -> std::vector<CpuSet>
+{
+    if (affinity.pinning == WorkerPinning::None || affinity.pinning == WorkerPinning::Explicit)
+    {
+        return ResolveWorkerCpuSets(affinity, worker_count, {});
+    }
+    return ResolveWorkerCpuSets(affinity, worker_count, GetNumaNodes());
+}
+
+auto PinCurrentThread(const CpuSet &cpus) -> bool
+{
+    if (cpus.empty())
+    {
+        return false;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+auto PinWorkerThread(const std::size_t worker, const CpuSet &cpus) -> void
+{
+    if (cpus.empty() || PinCurrentThread(cpus))
+    {
+        return;
+    }
+    LOG_WARNING("Failed to pin worker thread, it stays unpinned").AddContext("worker", std::to_string(worker));
+}
+
+auto GetCurrentThreadAffinity() -> CpuSet
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+    {
+        return {};
+    }
+    CpuSet cpus;
+    for (std::size_t cpu{0}; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &set))
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+#else
+    return AllCpus();
+#endif
+}
+
+} // namespace oxherdcpp
@@ -0,0 +1,288 @@
+#include <oxherdcpp/actor/scheduler/timing_wheel.h>
+
+#include <algorithm>
+
+namespace oxherdcpp
+{
+
+TimingWheel::TimingWheel(const Duration tick) : tick_{std::max(tick, Duration{1})}
+{
+}
+
+TimingWheel::~TimingWheel()
+{
+    Stop();
+}
+
+auto TimingWheel::ScheduleOnce(const Duration delay, ActorRef target, MPtr<BaseMessage> message) -> TimerHandle
+{
+    return Schedule(delay, Duration::zero(), std::move(target), std::move(message));
+}
+
+auto TimingWheel::ScheduleAtFixedRate(const Duration initial_delay, const Duration interval, ActorRef target,
+                                      MPtr<BaseMessage> message) -> TimerHandle
+{
+    return Schedule(initial_delay, std::max(interval, tick_), std::move(target), std::move(message));
+}
+
+auto TimingWheel::ScheduleCallback(const Duration delay, std::function<void()> callback) -> TimerHandle
+{
+    return Schedule(delay, Duration::zero(), ActorRef{ActorId{}, {}}, {}, std::move(callback));
+}
+
+auto TimingWheel::Cancel(const TimerHandle handle) -> bool
+{
+    std::lock_guard lock{mutex_};
+    if (!handle || handle.index >= node_count_)
+    {
+        return false;
+    }
+    if (const auto &node{GetNode(handle.index)}; !node.is_scheduled || node.generation != handle.generation)
+    {
+        return false;
+    }
+    Unlink(handle.index);
+    ReleaseNode(handle.index);
+    return true;
+}
+
+auto TimingWheel::GetTimerCount() const -> std::size_t
+{
+    std::lock_guard lock{mutex_};
+    return timer_count_;
+}
+
+auto TimingWheel::GetTick() const -> Duration
+{
+    return tick_;
+}
+
+auto TimingWheel::Stop() -> void
+{
+    {
+        std::lock_guard lock{mutex_};
+        is_stopped_ = true;
+    }
+    if (thread_.joinable())
+    {
+        thread_.request_stop();
+        thread_.join();
+    }
+    std::lock_guard lock{mutex_};
+    slots_ = {};
+    chunks_.clear();
+    due_.clear();
+    free_head_ = kNil;
+    node_count_ = 0;
+    timer_count_ = 0;
+}
+
+auto TimingWheel::Schedule(const Duration delay, const Duration interval, ActorRef target, MPtr<BaseMessage> message,
+                           std::function<void()> callback) -> TimerHandle
+{
+    // Deadlines are taken from the clock rather than from current_tick_, which lags while the thread sleeps
+    const auto elapsed{Clock::now() - start_};
+    const auto deadline{ToTicks(elapsed + std::max(delay, Duration::zero()))};
+
+    std::lock_guard lock{mutex_};
+    if (is_stopped_)
+    {
+        return TimerHandle{};
+    }
+    if (timer_count_ == 0)
+    {
+        // The wheel is empty, so the ticks missed while idle are skipped here instead of replayed by the thread
+        current_tick_ = std::max(current_tick_, static_cast<std::uint64_t>(elapsed / tick_));
+    }
+    const auto index{AllocateNode()};
+    auto &node{GetNode(index)};
+    node.deadline = std::max(deadline, current_tick_ + 1);
+    node.period = ToTicks(interval);
+    node.target = std::move(target);
+    node.message = std::move(message);
+    node.callback = std::move(callback);
+    Link(index);
+
+    if (!thread_.joinable())
+    {
+        thread_ = std::jthread{[this](const std::stop_token &stop_token) { TickLoop(stop_token); }};
+    }
+    else if (timer_count_ == 1)
+    {
+        timers_added_.notify_one();
+    }
+    return TimerHandle{.index = index, .generation = node.generation};
+}
+
+auto TimingWheel::ToTicks(const Duration duration) const -> std::uint64_t
+{
+    return static_cast<std::uint64_t>((duration.count() + tick_.count() - 1) / tick_.count());
+}
+
+auto TimingWheel::GetNode(const std::uint32_t index) -> Node &
+{
+    return chunks_[index / kChunkSize][index % kChunkSize];
+}
+
+auto TimingWheel::AllocateNode() -> std::uint32_t
+{
+    ++timer_count_;
+    if (free_head_ != kNil)
+    {
+        return std::exchange(free_head_, GetNode(free_head_).next);
+    }
+    if (node_count_ % kChunkSize == 0)
+    {
+        chunks_.push_back(MakeUptr<Node[]>(kChunkSize));
+    }
+    return node_count_++;
+}
+
+auto TimingWheel::ReleaseNode(const std::uint32_t index) -> void
+{
+    --timer_count_;
+    auto &node{GetNode(index)};
+    node.is_scheduled = false;
+    // Generation zero is reserved for empty handles
+    node.generation = node.generation == UINT32_MAX ? 1 : node.generation + 1;
+    node.target = ActorRef{ActorId{}, {}};
+    node.message.reset();
+    node.callback = nullptr;
+    node.prev = kNil;
+    node.next = std::exchange(free_head_, index);
+}
+
+auto TimingWheel::Link(const std::uint32_t index) -> void
+{
+    auto &node{GetNode(index)};
+    const auto remaining{std::min(node.deadline > current_tick_ ? node.deadline - current_tick_ : 0, kMaxTicks)};
+    node.deadline = current_tick_ + remaining;
+
+    std::size_t level{0};
+    while (level + 1 < kLevelCount && remaining >= (std::uint64_t{1} << (kSlotBits * (level + 1))))
+    {
+        ++level;
+    }
+    // An overdue node lands in the slot of the current tick, which Advance fires right after cascading
+    node.slot = static_cast<std::uint32_t>(level * kSlotCount +
+                                           ((node.deadline >> (kSlotBits * level)) & (kSlotCount - 1)));
+    auto &slot{slots_[node.slot]};
+    node.prev = kNil;
+    node.next = slot.head;
+    if (slot.head != kNil)
+    {
+        GetNode(slot.head).prev = index;
+    }
+    slot.head = index;
+    node.is_scheduled = true;
+}
+
+auto TimingWheel::Unlink(const std::uint32_t index) -> void
+{
+    auto &node{GetNode(index)};
+    if (node.prev != kNil)
+    {
+        GetNode(node.prev).next = node.next;
+    }
+    else
+    {
+        slots_[node.slot].head = node.next;
+    }
+    if (node.next != kNil)
+    {
+        GetNode(node.next).prev = node.prev;
+    }
+    node.prev = kNil;
+    node.next = kNil;
+    node.is_scheduled = false;
+}
+
+auto TimingWheel::Advance() -> void
+{
+    ++current_tick_;
+    for (std::size_t level{1}; level < kLevelCount; ++level)
+    {
+        if (((current_tick_ >> (kSlotBits * (level - 1))) & (kSlotCount - 1)) != 0)
+        {
+            break;
+        }
+        Cascade(level);
+    }
+
+    auto &slot{slots_[current_tick_ & (kSlotCount - 1)]};
+    auto index{std::exchange(slot.head, kNil)};
+    while (index != kNil)
+    {
+        auto &node{GetNode(index)};
+        const auto next{node.next};
+        node.prev = kNil;
+        node.next = kNil;
+        node.is_scheduled = false;
+        if (node.period != 0)
+        {
+            due_.push_back(Due{.target = node.target, .message = node.message, .callback = node.callback});
+            node.deadline += node.period;
+            Link(index);
+        }
+        else
+        {
+            due_.push_back(Due{.target = std::move(node.target),
+                               .message = std::move(node.message),
+                               .callback = std::move(node.callback)});
+            ReleaseNode(index);
+        }
+        index = next;
+    }
+}
+
+auto TimingWheel::Cascade(const std::size_t level) -> void
+{
+    auto &slot{slots_[level * kSlotCount + ((current_tick_ >> (kSlotBits * level)) & (kSlotCount - 1))]};
+    auto index{std::exchange(slot.head, kNil)};
+    while (index != kNil)
+    {
+        const auto next{GetNode(index).next};
+        Link(index);
+        index = next;
+    }
+}
+
+auto TimingWheel::TickLoop(const std::stop_token &stop_token) -> void
+{
+    std::vector<Due> delivering;
+    std::unique_lock lock{mutex_};
+    while (!stop_token.stop_requested())
+    {
+        if (timer_count_ == 0 &&
+            !timers_added_.wait(lock, stop_token, [this] { return timer_count_ != 0; }))
+        {
+            break;
+        }
+        const auto now{static_cast<std::uint64_t>((Clock::now() - start_) / tick_)};
+        while (current_tick_ < now && timer_count_ != 0)
+        {
+            Advance();
+        }
+        // Nothing is pending, skip the ticks missed while idle in one step
+        current_tick_ = std::max(current_tick_, now);
+
+        delivering.swap(due_);
+        lock.unlock();
+        for (auto &[target, message, callback] : delivering)
+        {
+            if (callback)
+            {
+                callback();
+                continue;
+            }
+            target.Tell(std::move(message));
+        }
+        delivering.clear();
+        lock.lock();
+
+        const auto next_tick{start_ + tick_ * static_cast<Duration::rep>(current_tick_ + 1)};
+        timers_added_.wait_until(lock, stop_token, next_tick, [] { return false; });
+    }
+}
+
+} // namespace oxherdcpp
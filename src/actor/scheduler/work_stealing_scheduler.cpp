@@ -0,0 +1,384 @@
+#include <oxherdcpp/actor/scheduler/work_stealing_scheduler.h>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <oxherdcpp/common/mpsc_queue.h>
+
+namespace oxherdcpp
+{
+namespace
+{
+// Bounds how many times in a row a worker may run its LIFO slot, so two actors pinging each other
+// cannot starve the rest of the local queue.
+constexpr std::size_t kMaxLifoPollsPerTick{3};
+
+// Every this many tasks the injection queue is checked before the local one, so foreign submissions
+// are not starved by a worker that keeps feeding itself.
+constexpr std::size_t kInjectedCheckInterval{61};
+
+constexpr std::size_t kMaxStealBatch{32};
+} // namespace
+
+struct WorkStealingScheduler::Worker
+{
+    static constexpr std::size_t kCapacity{256};
+
+    Worker(WorkStealingScheduler &owner, const std::size_t index)
+        : owner{&owner}, index{index}, random_state{0x9E3779B97F4A7C15ULL * (index + 1)}
+    {
+    }
+
+    // Single producer (the owning worker), many consumers (owner and thieves). Indices only grow, so a
+    // successful CAS on head_ proves the slot was not recycled under the reader.
+    auto Push(Task *task) -> bool
+    {
+        const auto tail{tail_.load(std::memory_order_relaxed)};
+        if (tail - head_.load(std::memory_order_acquire) >= kCapacity)
+        {
+            return false;
+        }
+        buffer_[tail % kCapacity].store(task, std::memory_order_relaxed);
+        tail_.store(tail + 1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    auto Pop() -> Task *
+    {
+        auto head{head_.load(std::memory_order_acquire)};
+        while (head < tail_.load(std::memory_order_acquire))
+        {
+            auto *task{buffer_[head % kCapacity].load(std::memory_order_relaxed)};
+            if (head_.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] auto GetSize() const -> std::size_t
+    {
+        const auto head{head_.load(std::memory_order_seq_cst)};
+        const auto tail{tail_.load(std::memory_order_seq_cst)};
+        return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+    }
+
+    auto NextRandom() -> std::uint64_t
+    {
+        random_state ^= random_state << 13;
+        random_state ^= random_state >> 7;
+        random_state ^= random_state << 17;
+        return random_state;
+    }
+
+    WorkStealingScheduler *owner;
+    std::size_t index;
+    std::uint64_t random_state;
+    // Owner-only state
+    Task *lifo_slot{nullptr};
+    std::size_t tick{0};
+
+  private:
+    alignas(kCacheLineSize) std::atomic<std::uint64_t> head_{0};
+    alignas(kCacheLineSize) std::atomic<std::uint64_t> tail_{0};
+    std::array<std::atomic<Task *>, kCapacity> buffer_{};
+};
+
+thread_local WorkStealingScheduler::Worker *WorkStealingScheduler::current_worker_{nullptr};
+
+WorkStealingScheduler::WorkStealingScheduler(const std::size_t thread_count, std::vector<CpuSet> worker_cpus,
+                                             const IdleStrategy idle_strategy)
+    : idle_strategy_{idle_strategy}
+{
+    const auto count{std::max<std::size_t>(thread_count, 1)};
+    workers_.reserve(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        workers_.push_back(MakeUptr<Worker>(*this, i));
+    }
+    worker_cpus.resize(count);
+    threads_.reserve(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        threads_.emplace_back([this, &worker = *workers_[i], cpus = std::move(worker_cpus[i])] {
+            PinWorkerThread(worker.index, cpus);
+            WorkerLoop(worker);
+        });
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    Stop();
+}
+
+auto WorkStealingScheduler::get_executor() noexcept -> executor_type
+{
+    return executor_type{*this};
+}
+
+auto WorkStealingScheduler::Stop() -> void
+{
+    if (stopping_.exchange(true))
+    {
+        return;
+    }
+    {
+        std::lock_guard lock{park_mutex_};
+        park_cv_.notify_all();
+    }
+    threads_.clear();
+    {
+        std::lock_guard lock{injected_mutex_};
+        stopped_ = true;
+    }
+    DestroyPendingTasks();
+}
+
+auto WorkStealingScheduler::GetThreadCount() const -> std::size_t
+{
+    return workers_.size();
+}
+
+auto WorkStealingScheduler::GetStealCount() const -> std::size_t
+{
+    return steal_count_.load(std::memory_order_relaxed);
+}
+
+auto WorkStealingScheduler::GetIdleStats() const -> IdleStats
+{
+    return idle_counters_.GetStats();
+}
+
+auto WorkStealingScheduler::RunningInThisThread() const -> bool
+{
+    return current_worker_ != nullptr && current_worker_->owner == this;
+}
+
+auto WorkStealingScheduler::Submit(Task *task, const bool is_continuation) -> void
+{
+    if (!RunningInThisThread())
+    {
+        PushInjected(task);
+        NotifyIdleWorker();
+        return;
+    }
+    auto &worker{*current_worker_};
+    if (is_continuation)
+    {
+        PushLocal(worker, task);
+    }
+    else if (auto *previous{std::exchange(worker.lifo_slot, task)}; previous != nullptr)
+    {
+        PushLocal(worker, previous);
+    }
+    else
+    {
+        // The LIFO slot cannot be stolen, nobody else needs waking
+        return;
+    }
+    NotifyIdleWorker();
+}
+
+auto WorkStealingScheduler::PushLocal(Worker &worker, Task *task) -> void
+{
+    if (!worker.Push(task))
+    {
+        PushInjected(task);
+    }
+}
+
+auto WorkStealingScheduler::PushInjected(Task *task) -> void
+{
+    {
+        std::lock_guard lock{injected_mutex_};
+        if (!stopped_)
+        {
+            injected_.push_back(task);
+            injected_size_.fetch_add(1, std::memory_order_seq_cst);
+            return;
+        }
+    }
+    // No worker is left to run it. Destroyed outside the lock, since its handler may submit again.
+    delete task;
+}
+
+auto WorkStealingScheduler::PopInjected() -> Task *
+{
+    if (injected_size_.load(std::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard lock{injected_mutex_};
+    if (injected_.empty())
+    {
+        return nullptr;
+    }
+
+    auto *task{injected_.front()};
+    injected_.pop_front();
+    injected_size_.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+}
+
+auto WorkStealingScheduler::Steal(Worker &thief) -> Task *
+{
+    const auto count{workers_.size()};
+    if (count < 2)
+    {
+        return nullptr;
+    }
+
+    const auto start{static_cast<std::size_t>(thief.NextRandom() % count)};
+    for (std::size_t offset{0}; offset < count; ++offset)
+    {
+        auto &victim{*workers_[(start + offset) % count]};
+        if (&victim == &thief)
+        {
+            continue;
+        }
+        auto *first{victim.Pop()};
+        if (first == nullptr)
+        {
+            continue;
+        }
+        // Take up to half of what is left so the thief does not come back for every single task
+        const auto batch{std::min(victim.GetSize() / 2, kMaxStealBatch)};
+        for (std::size_t i{0}; i < batch; ++i)
+        {
+            auto *task{victim.Pop()};
+            if (task == nullptr)
+            {
+                break;
+            }
+            PushLocal(thief, task);
+        }
+        steal_count_.fetch_add(1, std::memory_order_relaxed);
+        return first;
+    }
+    return nullptr;
+}
+
+auto WorkStealingScheduler::FindTask(Worker &worker) -> Task *
+{
+    if (++worker.tick % kInjectedCheckInterval == 0)
+    {
+        if (auto *task{PopInjected()})
+        {
+            return task;
+        }
+    }
+    if (auto *task{worker.Pop()})
+    {
+        return task;
+    }
+    if (auto *task{PopInjected()})
+    {
+        return task;
+    }
+    return Steal(worker);
+}
+
+auto WorkStealingScheduler::HasPendingWork() const -> bool
+{
+    if (injected_size_.load(std::memory_order_seq_cst) > 0)
+    {
+        return true;
+    }
+    for (const auto &worker : workers_)
+    {
+        if (worker->GetSize() > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto WorkStealingScheduler::NotifyIdleWorker() -> void
+{
+    // Pairs with the fence in Park: either the sleeper sees the new task or we see the sleeper
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_workers_.load(std::memory_order_seq_cst) == 0)
+    {
+        return;
+    }
+    std::lock_guard lock{park_mutex_};
+    park_cv_.notify_one();
+}
+
+auto WorkStealingScheduler::Park(Worker &) -> void
+{
+    std::unique_lock lock{park_mutex_};
+    idle_workers_.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!stopping_.load(std::memory_order_acquire) && !HasPendingWork())
+    {
+        park_cv_.wait(lock);
+    }
+    idle_workers_.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+auto WorkStealingScheduler::WorkerLoop(Worker &worker) -> void
+{
+    current_worker_ = &worker;
+    IdleBackoff backoff{idle_strategy_, idle_counters_};
+    std::size_t lifo_polls{0};
+    while (true)
+    {
+        Task *task{nullptr};
+        if (worker.lifo_slot != nullptr && lifo_polls < kMaxLifoPollsPerTick)
+        {
+            task = std::exchange(worker.lifo_slot, nullptr);
+            ++lifo_polls;
+        }
+        else
+        {
+            if (worker.lifo_slot != nullptr)
+            {
+                PushLocal(worker, std::exchange(worker.lifo_slot, nullptr));
+            }
+            lifo_polls = 0;
+            task = FindTask(worker);
+        }
+        if (task == nullptr)
+        {
+            // Like io_context::run, a stopping worker leaves only once there is nothing left to do
+            if (stopping_.load(std::memory_order_acquire))
+            {
+                break;
+            }
+            // A spinning worker is not counted as idle, so submitters skip the wake-up it would cost
+            if (backoff.Idle())
+            {
+                Park(worker);
+            }
+            continue;
+        }
+        backoff.Busy();
+        const Uptr<Task> owned{task};
+        owned->Run();
+    }
+    current_worker_ = nullptr;
+}
+
+auto WorkStealingScheduler::DestroyPendingTasks() -> void
+{
+    for (auto &worker : workers_)
+    {
+        delete std::exchange(worker->lifo_slot, nullptr);
+        while (auto *task{worker->Pop()})
+        {
+            delete task;
+        }
+    }
+    while (auto *task{PopInjected()})
+    {
+        delete task;
+    }
+}
+
+} // namespace oxherdcpp
@@ -1,4 +1,8 @@
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -6,7 +10,10 @@
 
 #include <oxherdcpp/actor/actor.h>
 #include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
 #include <oxherdcpp/actor/actor_system_facade.h>
+#include <oxherdcpp/actor/dead_letter_office.h>
 #include <oxherdcpp/actor/events.h>
 
 namespace testing
@@ -500,6 +507,34 @@ TEST_F(ActorTests, BehaviourIsCalledForUserMessagesInRunningState)
     EXPECT_EQ(actor->behaviour_calls, 1) << "Behaviour must be called exactly once in Running state";
 }
 
+TEST_F(ActorTests, MessageDispatcherSelectsHandlerByTypeIndex)
+{
+    struct FirstMessage final : ox::Message<FirstMessage>
+    {
+    };
+    struct SecondMessage final : ox::Message<SecondMessage>
+    {
+    };
+    struct UnhandledMessage final : ox::Message<UnhandledMessage>
+    {
+    };
+
+    int first_calls{0};
+    int second_calls{0};
+    ox::MessageDispatcher dispatcher;
+    dispatcher.RegisterHandler<SecondMessage>([&](const ox::MPtr<SecondMessage> &) { ++second_calls; })
+        .RegisterHandler<FirstMessage>([&](const ox::MPtr<FirstMessage> &) { ++first_calls; });
+
+    dispatcher.Dispatch(ox::MakeMessage<FirstMessage>());
+    dispatcher.Dispatch(ox::MakeMessage<SecondMessage>());
+    dispatcher.Dispatch(ox::MakeMessage<SecondMessage>());
+    // Тип без обработчика (и с индексом за пределами таблицы) просто пропускается
+    dispatcher.Dispatch(ox::MakeMessage<UnhandledMessage>());
+
+    EXPECT_EQ(first_calls, 1);
+    EXPECT_EQ(second_calls, 2);
+}
+
 TEST_F(ActorTests, UserMessagesAreIgnoredInNonRunningStates)
 {
     struct UserMessage final : ox::Message<UserMessage>
@@ -574,6 +609,182 @@ TEST_F(ActorTests, UserMessagesAreIgnoredInNonRunningStates)
     }
 }
 
+TEST_F(ActorTests, StashedMessagesAreReplayedInOrderOnStartAndResume)
+{
+    struct SeqMessage final : ox::Message<SeqMessage>
+    {
+        explicit SeqMessage(const int value) : value{value}
+        {
+        }
+        int value;
+    };
+
+    class RecordingActor final : public ox::Actor
+    {
+      public:
+        using Actor::Actor;
+        std::vector<int> received;
+
+      protected:
+        void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+        {
+            received.push_back(ox::Cast<SeqMessage>(message)->value);
+        }
+    };
+
+    const auto actor{CreateActor<RecordingActor>()};
+    for (int i{0}; i < 3; ++i)
+    {
+        actor->Receive(ox::MakeMessage<SeqMessage>(i));
+    }
+    Start();
+    Restart();
+    EXPECT_TRUE(actor->received.empty());
+    EXPECT_EQ(actor->GetStashSize(), 3u);
+
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    actor->Receive(ox::MakeMessage<SeqMessage>(3));
+    Start();
+    Restart();
+    EXPECT_EQ(actor->received, (std::vector<int>{0, 1, 2, 3})) << "Stash must be replayed before later messages";
+    EXPECT_EQ(actor->GetStashSize(), 0u);
+
+    actor->Receive(ox::MakeMessage<ox::GoPauseActor>());
+    Start();
+    Restart();
+    actor->Receive(ox::MakeMessage<SeqMessage>(4));
+    actor->Receive(ox::MakeMessage<SeqMessage>(5));
+    Start();
+    Restart();
+    EXPECT_EQ(actor->received.size(), 4u) << "Paused actor must not process user messages";
+
+    actor->Receive(ox::MakeMessage<ox::GoResumeActor>());
+    Start();
+    EXPECT_EQ(actor->received, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST_F(ActorTests, MovedMessagesReachBehaviourAsTheOnlyReference)
+{
+    class UseCountActor final : public ox::Actor
+    {
+      public:
+        using Actor::Actor;
+        std::vector<std::uint32_t> use_counts;
+
+      protected:
+        void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+        {
+            use_counts.push_back(message->use_count());
+        }
+    };
+
+    const auto actor{CreateActor<UseCountActor>()};
+    const ox::ActorRef actor_ref{actor, {}};
+    // До старта сообщение ложится в stash и переигрывается оттуда, тоже без копий
+    actor->Receive(ox::MakeMessage<TestMessage>());
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    auto message{ox::MakeMessage<TestMessage>()};
+    ox::ActorRef{actor_ref}.Tell(std::move(message));
+    Start();
+
+    EXPECT_EQ(actor->use_counts, (std::vector<std::uint32_t>{1, 1}));
+}
+
+TEST_F(ActorTests, StashOverflowGoesToDeadLetters)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("stash-tests", 1)};
+    const auto actor{system->CreateActor<CounterActor>(ox::ActorOptions{.stash_capacity = 2}, "stashing")};
+    const auto disabled{system->CreateActor<CounterActor>(ox::ActorOptions{.stash_capacity = 0}, "not-stashing")};
+    for (int i{0}; i < 5; ++i)
+    {
+        actor->Receive(ox::MakeMessage<TestMessage>());
+        disabled->Receive(ox::MakeMessage<TestMessage>());
+    }
+
+    const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds{2}};
+    while (system->GetDeadLetterCount() < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(system->GetDeadLetterCount(), 3u) << "Only the stash overflow is dead-lettered";
+
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    disabled->Receive(ox::MakeMessage<ox::GoStartActor>());
+    while ((actor->calls.load() < 2 || !disabled->GetState().IsRunning()) &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(actor->calls.load(), 2);
+    EXPECT_EQ(disabled->calls.load(), 0) << "A zero capacity drops messages as before";
+    system->Stop();
+}
+
+TEST_F(ActorTests, StashIsDeadLetteredOnStopAndTerminate)
+{
+    class DeadLetterRecorder final : public ox::Actor
+    {
+      public:
+        using Actor::Actor;
+        std::mutex mutex;
+        std::vector<ox::DeadLetterReason> reasons;
+
+      protected:
+        void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+        {
+            std::lock_guard lock{mutex};
+            reasons.push_back(ox::Cast<ox::DeadLetter>(message)->reason);
+        }
+    };
+
+    const auto system{ox::MakeSptr<ox::ActorSystem>("stash-tests", 1)};
+    const auto recorder{system->CreateActor<DeadLetterRecorder>("recorder")};
+    recorder->Receive(ox::MakeMessage<ox::GoStartActor>());
+    system->GetDeadLetters().Tell(ox::MakeMessage<ox::SubscribeDeadLettersMessage>(ox::ActorRef{recorder, system}));
+    const auto actor{system->CreateActor<CounterActor>("stashing")};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+
+    const auto wait_until{[](auto predicate) {
+        const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds{2}};
+        while (!predicate() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return predicate();
+    }};
+    const auto stash{[&](const std::size_t count) {
+        actor->Receive(ox::MakeMessage<ox::GoPauseActor>());
+        EXPECT_TRUE(wait_until([&] { return actor->GetState().IsPaused(); }));
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            actor->Receive(ox::MakeMessage<TestMessage>());
+        }
+        EXPECT_TRUE(wait_until([&] { return actor->GetStashSize() == count; }));
+    }};
+
+    // Остановка выбрасывает stash в dead letters, перезапуск его не переигрывает
+    stash(2);
+    actor->Receive(ox::MakeMessage<ox::GoStopActor>());
+    EXPECT_TRUE(wait_until([&] { return system->GetDeadLetterCount() == 2; }));
+    EXPECT_EQ(actor->GetStashSize(), 0u);
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    EXPECT_TRUE(wait_until([&] { return actor->GetState().IsRunning(); }));
+
+    stash(3);
+    actor->Receive(ox::MakeMessage<ox::GoTerminateActor>());
+    EXPECT_TRUE(wait_until([&] { return system->GetDeadLetterCount() == 5; }));
+    EXPECT_EQ(actor->GetStashSize(), 0u);
+    EXPECT_EQ(actor->calls.load(), 0) << "Stale messages must not be replayed";
+
+    EXPECT_TRUE(wait_until([&] {
+        std::lock_guard lock{recorder->mutex};
+        return recorder->reasons.size() == 5;
+    }));
+    std::lock_guard lock{recorder->mutex};
+    EXPECT_EQ(recorder->reasons, std::vector<ox::DeadLetterReason>(5, ox::DeadLetterReason::StashDiscarded));
+    system->Stop();
+}
+
 TEST_F(ActorTests, StrandProcessesMessagesSequentiallyInMultithreadedScenario)
 {
     struct SeqMessage final : ox::Message<SeqMessage>
@@ -0,0 +1,182 @@
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/ask.h>
+#include <oxherdcpp/actor/events.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+struct DoubleRequest final : ox::RequestMessage<DoubleRequest>
+{
+    explicit DoubleRequest(const int value) : value{value}
+    {
+    }
+
+    int value;
+};
+
+struct DoubleReply final : ox::Message<DoubleReply>
+{
+    explicit DoubleReply(const int value) : value{value}
+    {
+    }
+
+    int value;
+};
+
+struct IgnoredRequest final : ox::RequestMessage<IgnoredRequest>
+{
+};
+
+// Answers DoubleRequest, keeps IgnoredRequest unanswered so the test can reply late.
+class DoublingActor final : public ox::Actor
+{
+  public:
+    DoublingActor(const ox::Executor &executor, const std::string &name, const ox::ActorId id)
+        : Actor(executor, name, id)
+    {
+        GetMessageDispatcher()
+            .RegisterHandler<DoubleRequest>([](const auto &request) {
+                request->reply_to.Tell(ox::MakeMessage<DoubleReply>(request->value * 2));
+            })
+            .RegisterHandler<IgnoredRequest>([this](const auto &request) {
+                ignored = request->reply_to;
+                ignored_count.fetch_add(1);
+            });
+    }
+
+    ox::ReplyTo ignored{};
+    std::atomic<std::size_t> ignored_count{0};
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        GetMessageDispatcher().Dispatch(message);
+    }
+};
+
+class AskTests : public Test
+{
+  protected:
+    void SetUp() override
+    {
+        system_ = ox::MakeSptr<ox::ActorSystem>("ask-tests", ox::ActorSystemConfig{.thread_count = 2});
+        actor_ = system_->CreateActor<DoublingActor>("doubler");
+        actor_->Receive(ox::MakeMessage<ox::GoStartActor>());
+        ref_.emplace(actor_, system_);
+    }
+
+    void TearDown() override
+    {
+        system_->Stop();
+    }
+
+    ox::Sptr<ox::ActorSystem> system_;
+    ox::Sptr<DoublingActor> actor_;
+    std::optional<ox::ActorRef> ref_;
+};
+
+TEST_F(AskTests, FutureReceivesReply)
+{
+    auto future{ref_->Ask<DoubleReply>(ox::MakeMessage<DoubleRequest>(21), 1s)};
+
+    const auto reply{future.Get()};
+    ASSERT_NE(reply, nullptr);
+    EXPECT_EQ(reply->value, 42);
+    EXPECT_TRUE(future.IsReady());
+}
+
+TEST_F(AskTests, UnansweredAskTimesOut)
+{
+    auto future{ref_->Ask<DoubleReply>(ox::MakeMessage<IgnoredRequest>(), 20ms)};
+
+    EXPECT_THROW(future.Get(), ox::AskTimeoutError);
+    // Опоздавший ответ отбрасывается
+    ASSERT_EQ(actor_->ignored_count.load(), 1u);
+    EXPECT_FALSE(actor_->ignored.Tell(ox::MakeMessage<DoubleReply>(0)));
+    EXPECT_EQ(actor_->ignored.GetRequestId(), future.GetRequestId());
+}
+
+TEST_F(AskTests, CallbackReceivesReplyOrNullOnTimeout)
+{
+    std::promise<int> replied;
+    ref_->Ask<DoubleReply>(ox::MakeMessage<DoubleRequest>(5), 1s, [&](const ox::MPtr<DoubleReply> &reply) {
+        replied.set_value(reply ? reply->value : -1);
+    });
+    auto replied_future{replied.get_future()};
+    ASSERT_EQ(replied_future.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(replied_future.get(), 10);
+
+    // The timer thread gives up on the ask, nobody is blocked in Get
+    std::promise<bool> timed_out;
+    ref_->Ask<DoubleReply>(ox::MakeMessage<IgnoredRequest>(), 10ms,
+                           [&](const ox::MPtr<DoubleReply> &reply) { timed_out.set_value(reply == nullptr); });
+    auto timed_out_future{timed_out.get_future()};
+    ASSERT_EQ(timed_out_future.wait_for(5s), std::future_status::ready);
+    EXPECT_TRUE(timed_out_future.get());
+}
+
+TEST_F(AskTests, ReplyOfAnotherTypeIsNull)
+{
+    auto future{ref_->Ask<ox::DeadLetter>(ox::MakeMessage<DoubleRequest>(1), 1s)};
+
+    EXPECT_EQ(future.Get(), nullptr);
+}
+
+TEST_F(AskTests, PipelinedAsksGetTheirOwnReplies)
+{
+    std::vector<ox::AskFuture<DoubleReply>> futures;
+    std::set<ox::RequestId> request_ids;
+    for (int i{0}; i < 100; ++i)
+    {
+        futures.push_back(ref_->Ask<DoubleReply>(ox::MakeMessage<DoubleRequest>(i), 5s));
+        request_ids.insert(futures.back().GetRequestId());
+    }
+    EXPECT_EQ(request_ids.size(), futures.size());
+
+    for (int i{0}; i < 100; ++i)
+    {
+        EXPECT_EQ(futures[i].Get()->value, i * 2);
+    }
+}
+
+TEST_F(AskTests, AnsweredAskCancelsItsTimeout)
+{
+    auto future{ref_->Ask<DoubleReply>(ox::MakeMessage<DoubleRequest>(2), 1h)};
+
+    ASSERT_NE(future.Get(), nullptr);
+    EXPECT_EQ(system_->GetTimingWheel().GetTimerCount(), 0u);
+}
+
+TEST(ReplySlotTests, CompletesOnce)
+{
+    ox::ReplySlot slot{7};
+
+    EXPECT_EQ(slot.GetStatus(), ox::AskStatus::Pending);
+    EXPECT_TRUE(slot.Complete(ox::MakeMessage<DoubleReply>(1)));
+    EXPECT_FALSE(slot.Complete(ox::MakeMessage<DoubleReply>(2)));
+    EXPECT_FALSE(slot.Expire());
+    EXPECT_EQ(slot.Wait(std::chrono::steady_clock::now()), ox::AskStatus::Replied);
+    EXPECT_EQ(ox::Cast<DoubleReply>(slot.GetReply())->value, 1);
+
+    const ox::ReplyTo nobody{};
+    EXPECT_FALSE(nobody);
+    EXPECT_FALSE(nobody.Tell(ox::MakeMessage<DoubleReply>(3)));
+}
+
+} // namespace testing
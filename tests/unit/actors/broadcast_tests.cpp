@@ -0,0 +1,161 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/broadcast.h>
+#include <oxherdcpp/actor/events.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+} // namespace
+
+struct AnnouncementMessage final : ox::Message<AnnouncementMessage>
+{
+};
+
+class ListenerActor final : public ox::Actor
+{
+  public:
+    ListenerActor(const ox::Executor &executor, const std::string &name, const ox::ActorId id,
+                  std::atomic<std::size_t> &received, const ox::BaseMessage *expected)
+        : Actor(executor, name, id), received_{received}, expected_{expected}
+    {
+    }
+
+    std::uint32_t seen_use_count{0};
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        // Получатель видит само сообщение, а не конверт
+        if (message.get() == expected_ && message->IsA<AnnouncementMessage>())
+        {
+            seen_use_count = message->use_count();
+            received_.fetch_add(1);
+        }
+    }
+
+  private:
+    std::atomic<std::size_t> &received_;
+    const ox::BaseMessage *expected_;
+};
+
+TEST(BroadcastTests, SharesOneMessageReferencePerShard)
+{
+    boost::asio::io_context io_context;
+    std::atomic<std::size_t> received{0};
+    const auto message{ox::MakeMessage<AnnouncementMessage>()};
+
+    std::vector<ox::Sptr<ListenerActor>> actors;
+    ox::BroadcastGroup group{ox::BroadcastOptions{.shard_size = 100}};
+    for (std::size_t i{0}; i < 1000; ++i)
+    {
+        actors.push_back(ox::MakeSptr<ListenerActor>(io_context.get_executor(), "listener",
+                                                     ox::ActorIDGenerator::Generate(), received, message.get()));
+        actors.back()->Receive(ox::MakeMessage<ox::GoStartActor>());
+        group.Add(ox::ActorRef{actors.back(), {}});
+    }
+    EXPECT_EQ(group.GetSize(), 1000u);
+
+    group.Broadcast(message);
+    EXPECT_EQ(message->use_count(), 11u) << "Mailboxes must reference the message once per shard";
+
+    io_context.run();
+    EXPECT_EQ(received.load(), 1000u);
+    EXPECT_EQ(message->use_count(), 1u);
+}
+
+TEST(BroadcastTests, RecipientsBorrowTheMessageFromTheEnvelope)
+{
+    boost::asio::io_context io_context;
+    std::atomic<std::size_t> received{0};
+    const auto message{ox::MakeMessage<AnnouncementMessage>()};
+
+    std::vector<ox::Sptr<ListenerActor>> actors;
+    std::vector<ox::ActorRef> recipients;
+    for (std::size_t i{0}; i < 3; ++i)
+    {
+        actors.push_back(ox::MakeSptr<ListenerActor>(io_context.get_executor(), "listener",
+                                                     ox::ActorIDGenerator::Generate(), received, message.get()));
+        actors.back()->Receive(ox::MakeMessage<ox::GoStartActor>());
+        recipients.push_back(ox::ActorRef{actors.back(), {}});
+    }
+    ox::Broadcast(recipients, message);
+    ASSERT_EQ(message->use_count(), 2u);
+
+    // Ссылки держат только тест и конверт: обработка у получателя счётчик сообщения не трогает
+    io_context.run();
+    ASSERT_EQ(received.load(), 3u);
+    for (const auto &actor : actors)
+    {
+        EXPECT_EQ(actor->seen_use_count, 2u);
+    }
+    EXPECT_EQ(message->use_count(), 1u);
+}
+
+TEST(BroadcastTests, LargeGroupIsEnqueuedInParallel)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("broadcast-tests", ox::ActorSystemConfig{.thread_count = 4})};
+    std::atomic<std::size_t> received{0};
+    const auto message{ox::MakeMessage<AnnouncementMessage>()};
+
+    std::vector<ox::Sptr<ListenerActor>> actors;
+    std::vector<ox::ActorRef> recipients;
+    for (std::size_t i{0}; i < 5000; ++i)
+    {
+        actors.push_back(system->CreateActor<ListenerActor>("listener", received, message.get()));
+        actors.back()->Receive(ox::MakeMessage<ox::GoStartActor>());
+        recipients.emplace_back(actors.back(), system);
+    }
+
+    system->Broadcast(recipients, message, ox::BroadcastOptions{.shard_size = 64, .parallel_threshold = 1000});
+    EXPECT_TRUE(WaitUntil([&] { return received.load() == 5000; }));
+    system->Stop();
+}
+
+TEST(BroadcastTests, BroadcastSystemMessageUsesSystemLane)
+{
+    boost::asio::io_context io_context;
+    std::atomic<std::size_t> received{0};
+    const auto actor{ox::MakeSptr<ListenerActor>(io_context.get_executor(), "listener",
+                                                 ox::ActorIDGenerator::Generate(), received, nullptr)};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    io_context.run();
+    io_context.restart();
+
+    std::vector<ox::ActorRef> recipients{ox::ActorRef{actor, {}}};
+    ox::Broadcast(recipients, ox::MakeMessage<ox::GoStopActor>());
+    EXPECT_EQ(actor->GetMailbox().GetSize(), 0u) << "System messages stay out of the user lane";
+
+    io_context.run();
+    EXPECT_TRUE(actor->GetState().IsStopped());
+}
+
+} // namespace testing
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/message/byte_buffer.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+struct PayloadMessage final : ox::Message<PayloadMessage>
+{
+    explicit PayloadMessage(ox::ByteChain payload) : payload{std::move(payload)}
+    {
+    }
+
+    ox::ByteChain payload;
+};
+
+// Пересылает полезную нагрузку дальше в новом сообщении, не копируя байты
+class ForwardingActor final : public ox::Actor
+{
+  public:
+    ForwardingActor(const ox::Executor &executor, std::string name, const ox::ActorId actor_id, ox::ActorRef next)
+        : Actor{executor, std::move(name), actor_id}, next_{std::move(next)}
+    {
+    }
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        next_.Tell(ox::MakeMessage<PayloadMessage>(ox::Cast<PayloadMessage>(message)->payload));
+    }
+
+  private:
+    ox::ActorRef next_;
+};
+
+class PayloadSinkActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    std::vector<ox::ByteChain> received;
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        received.push_back(ox::Cast<PayloadMessage>(message)->payload);
+    }
+};
+
+TEST(ByteBufferTests, CopiesAndSlicesShareTheBlock)
+{
+    auto buffer{ox::ByteBuffer::Copy(std::string_view{"hello, world"})};
+    EXPECT_EQ(buffer.GetText(), "hello, world");
+    EXPECT_EQ(buffer.GetUseCount(), 1u);
+
+    const auto copy{buffer};
+    const auto world{buffer.Slice(7)};
+    EXPECT_EQ(world.GetText(), "world");
+    EXPECT_EQ(world.GetData(), buffer.GetData() + 7);
+    EXPECT_EQ(buffer.GetUseCount(), 3u);
+
+    // Срез держит блок живым и после исчезновения исходного буфера
+    buffer = {};
+    EXPECT_EQ(world.GetText(), "world");
+    EXPECT_EQ(world.Slice(1, 3).GetText(), "orl");
+    EXPECT_EQ(world.Slice(5).GetSize(), 0u);
+    EXPECT_THROW((void)world.Slice(6), std::out_of_range);
+    EXPECT_EQ(copy, ox::ByteBuffer::Copy(std::string_view{"hello, world"}));
+}
+
+TEST(ByteBufferTests, BuildFillsTheBlockInPlace)
+{
+    const auto buffer{ox::ByteBuffer::Build(3, [](const std::span<std::byte> bytes) {
+        std::ranges::fill(bytes, std::byte{'x'});
+    })};
+    EXPECT_EQ(buffer.GetText(), "xxx");
+}
+
+TEST(ByteBufferTests, SmallBlocksAreReusedFromTheirSizeClass)
+{
+    const void *first{nullptr};
+    {
+        const auto buffer{ox::ByteBuffer::Copy(std::string(200, 'a'))};
+        first = buffer.GetData();
+    }
+    const auto same_class{ox::ByteBuffer::Copy(std::string(100, 'b'))};
+    EXPECT_EQ(same_class.GetData(), first);
+
+    const auto inventory{ox::GetPoolInventory()};
+    EXPECT_TRUE(std::ranges::any_of(inventory, [](const ox::PoolReport &report) {
+        return report.name == "oxherdcpp::ByteBlock<256>" && report.blocks_out > 0;
+    }));
+
+    // Крупнее самого большого класса — отдельный блок из кучи
+    const auto large{ox::ByteBuffer::Copy(std::string(ox::kByteBlockSizeClasses.back() + 1, 'c'))};
+    EXPECT_EQ(large.GetText(), std::string(ox::kByteBlockSizeClasses.back() + 1, 'c'));
+}
+
+TEST(ByteBufferTests, ChainsLinkSegmentsWithoutCopying)
+{
+    const auto head{ox::ByteBuffer::Copy(std::string_view{"abc"})};
+    const auto tail{ox::ByteBuffer::Copy(std::string_view{"defgh"})};
+    ox::ByteChain chain{head};
+    chain.Append(ox::ByteBuffer{}).Append(tail);
+    ASSERT_EQ(chain.GetSegments().size(), 2u);
+    EXPECT_EQ(chain.GetSize(), 8u);
+    EXPECT_EQ(chain.GetSegments()[1].GetData(), tail.GetData());
+
+    const auto middle{chain.Slice(2, 3)};
+    ASSERT_EQ(middle.GetSegments().size(), 2u);
+    EXPECT_EQ(middle.GetSegments()[0].GetText(), "c");
+    EXPECT_EQ(middle.GetSegments()[1].GetText(), "de");
+    EXPECT_EQ(middle.GetSegments()[1].GetData(), tail.GetData());
+    EXPECT_THROW((void)chain.Slice(9), std::out_of_range);
+
+    EXPECT_EQ(chain.Flatten().GetText(), "abcdefgh");
+    EXPECT_EQ(chain.Slice(3).Flatten().GetData(), tail.GetData()) << "One segment is not copied";
+    std::array<std::byte, 4> prefix{};
+    EXPECT_EQ(chain.CopyTo(prefix), 4u);
+    EXPECT_EQ(ox::ByteBuffer::Copy(prefix).GetText(), "abcd");
+
+    // Равенство сравнивает байты, а не границы сегментов
+    EXPECT_EQ(chain, ox::ByteChain{ox::ByteBuffer::Copy(std::string_view{"abcdefgh"})});
+    EXPECT_NE(chain, ox::ByteChain{ox::ByteBuffer::Copy(std::string_view{"abcdefgX"})});
+
+    chain.Append(chain);
+    EXPECT_EQ(chain.Flatten().GetText(), "abcdefghabcdefgh");
+}
+
+TEST(ByteBufferTests, PayloadIsForwardedBetweenActorsWithoutCopying)
+{
+    boost::asio::io_context io_context;
+    const auto sink{
+        ox::MakeSptr<PayloadSinkActor>(io_context.get_executor(), "sink", ox::ActorIDGenerator::Generate())};
+    const auto forwarder{ox::MakeSptr<ForwardingActor>(io_context.get_executor(), "forwarder",
+                                                       ox::ActorIDGenerator::Generate(), ox::ActorRef{sink, {}})};
+    sink->Receive(ox::MakeMessage<ox::GoStartActor>());
+    forwarder->Receive(ox::MakeMessage<ox::GoStartActor>());
+
+    const auto payload{ox::ByteBuffer::Copy(std::string(4096, 'p'))};
+    forwarder->Receive(ox::MakeMessage<PayloadMessage>(ox::ByteChain{payload}));
+    io_context.run();
+
+    ASSERT_EQ(sink->received.size(), 1u);
+    ASSERT_EQ(sink->received.front().GetSegments().size(), 1u);
+    EXPECT_EQ(sink->received.front().GetSegments().front().GetData(), payload.GetData());
+}
+
+} // namespace testing
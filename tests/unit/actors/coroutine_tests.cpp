@@ -0,0 +1,260 @@
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/coroutine.h>
+#include <oxherdcpp/actor/events.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+} // namespace
+
+struct SquareRequest final : ox::RequestMessage<SquareRequest>
+{
+    explicit SquareRequest(const int value) : value{value}
+    {
+    }
+
+    int value;
+};
+
+struct SquareReply final : ox::Message<SquareReply>
+{
+    explicit SquareReply(const int value) : value{value}
+    {
+    }
+
+    int value;
+};
+
+struct SumSquaresMessage final : ox::Message<SumSquaresMessage>
+{
+};
+
+struct SleepThenCountMessage final : ox::Message<SleepThenCountMessage>
+{
+    SleepThenCountMessage() = default;
+
+    explicit SleepThenCountMessage(const std::chrono::milliseconds delay) : delay{delay}
+    {
+    }
+
+    std::chrono::milliseconds delay{5ms};
+};
+
+struct FailAfterSleepMessage final : ox::Message<FailAfterSleepMessage>
+{
+};
+
+class SquaringActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        if (const auto request{ox::Cast<SquareRequest>(message)})
+        {
+            request->reply_to.Tell(ox::MakeMessage<SquareReply>(request->value * request->value));
+        }
+    }
+};
+
+// Handles its messages with coroutines. Counters are plain integers: every resumption is a turn of this
+// actor, so they are never touched concurrently.
+class AwaitingActor final : public ox::Actor
+{
+  public:
+    AwaitingActor(const ox::Executor &executor, const std::string &name, const ox::ActorId id,
+                  ox::Sptr<ox::ActorSystem> system, ox::Sptr<SquaringActor> squarer)
+        : Actor(executor, name, id), squarer_{squarer, system}
+    {
+        GetMessageDispatcher()
+            .RegisterHandler<SumSquaresMessage>([this](ox::MPtr<SumSquaresMessage> message) { SumSquares(message); })
+            .RegisterHandler<SleepThenCountMessage>(
+                [this](ox::MPtr<SleepThenCountMessage> message) { SleepThenCount(message); })
+            .RegisterHandler<FailAfterSleepMessage>(
+                [this](ox::MPtr<FailAfterSleepMessage> message) { FailAfterSleep(message); });
+    }
+
+    std::atomic<int> sum{0};
+    std::atomic<int> counted{0};
+    std::atomic<int> sleeping{0};
+    std::vector<std::thread::id> resumed_on;
+    std::atomic<std::size_t> live_frames_while_sleeping{0};
+
+    // Set on the actor's turn before the first frame is released
+    ox::Sptr<ox::CoroutineFramePool> frame_pool;
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        GetMessageDispatcher().Dispatch(message);
+    }
+
+  private:
+    auto SumSquares(ox::MPtr<SumSquaresMessage>) -> ox::ActorTask
+    {
+        // Все запросы уходят сразу, ответы ждём по очереди
+        frame_pool = ox::CoroutineAccess::GetFramePool(*this);
+        std::vector<ox::AskFuture<SquareReply>> replies;
+        for (int i{1}; i <= 3; ++i)
+        {
+            replies.push_back(squarer_.Ask<SquareReply>(ox::MakeMessage<SquareRequest>(i), 5s));
+        }
+        int total{0};
+        for (auto &reply : replies)
+        {
+            total += (co_await std::move(reply))->value;
+        }
+        sum.store(total);
+    }
+
+    auto SleepThenCount(ox::MPtr<SleepThenCountMessage> message) -> ox::ActorTask
+    {
+        frame_pool = ox::CoroutineAccess::GetFramePool(*this);
+        sleeping.fetch_add(1);
+        co_await ox::Sleep(message->delay);
+        live_frames_while_sleeping.store(
+            std::max(live_frames_while_sleeping.load(), frame_pool->GetLiveFrameCount()));
+        resumed_on.push_back(std::this_thread::get_id());
+        counted_plain_ += 1;
+        counted.store(counted_plain_);
+    }
+
+    auto FailAfterSleep(ox::MPtr<FailAfterSleepMessage>) -> ox::ActorTask
+    {
+        co_await ox::Sleep(1ms);
+        throw std::runtime_error{"failed after resuming"};
+    }
+
+    ox::ActorRef squarer_;
+    int counted_plain_{0};
+};
+
+class CoroutineTests : public Test
+{
+  protected:
+    void SetUp() override
+    {
+        system_ = ox::MakeSptr<ox::ActorSystem>("coroutine-tests", ox::ActorSystemConfig{.thread_count = 4});
+        squarer_ = system_->CreateActor<SquaringActor>("squarer");
+        squarer_->Receive(ox::MakeMessage<ox::GoStartActor>());
+        actor_ = system_->CreateActor<AwaitingActor>("awaiter", system_, squarer_);
+        actor_->Receive(ox::MakeMessage<ox::GoStartActor>());
+    }
+
+    void TearDown() override
+    {
+        system_->Stop();
+    }
+
+    ox::Sptr<ox::ActorSystem> system_;
+    ox::Sptr<SquaringActor> squarer_;
+    ox::Sptr<AwaitingActor> actor_;
+};
+
+TEST_F(CoroutineTests, AwaitsPipelinedAsks)
+{
+    actor_->Receive(ox::MakeMessage<SumSquaresMessage>());
+
+    ASSERT_TRUE(WaitUntil([&] { return actor_->sum.load() == 1 + 4 + 9; }));
+    EXPECT_TRUE(WaitUntil([&] { return actor_->frame_pool->GetLiveFrameCount() == 0; }));
+}
+
+TEST_F(CoroutineTests, SleepResumesOnTheActorsTurns)
+{
+    for (int i{0}; i < 50; ++i)
+    {
+        actor_->Receive(ox::MakeMessage<SleepThenCountMessage>());
+    }
+
+    ASSERT_TRUE(WaitUntil([&] { return actor_->counted.load() == 50; }));
+    EXPECT_EQ(actor_->resumed_on.size(), 50u);
+    // Пятьдесят корутин спали одновременно, их кадры брались из пула актора
+    EXPECT_GT(actor_->live_frames_while_sleeping.load(), 1u);
+    EXPECT_TRUE(WaitUntil([&] { return actor_->frame_pool->GetLiveFrameCount() == 0; }));
+}
+
+TEST_F(CoroutineTests, ExceptionAfterResumeFailsTheActor)
+{
+    actor_->Receive(ox::MakeMessage<FailAfterSleepMessage>());
+
+    EXPECT_TRUE(WaitUntil([&] { return !actor_->GetState().IsRunning(); }));
+}
+
+TEST_F(CoroutineTests, PausedActorResumesCoroutineAfterResume)
+{
+    actor_->Receive(ox::MakeMessage<SleepThenCountMessage>(50ms));
+    ASSERT_TRUE(WaitUntil([&] { return actor_->sleeping.load() == 1; }));
+    actor_->Receive(ox::MakeMessage<ox::GoPauseActor>());
+
+    // Сон давно закончился, но на паузе корутина не продолжается
+    std::this_thread::sleep_for(150ms);
+    EXPECT_EQ(actor_->counted.load(), 0);
+
+    actor_->Receive(ox::MakeMessage<ox::GoResumeActor>());
+    EXPECT_TRUE(WaitUntil([&] { return actor_->counted.load() == 1; }));
+}
+
+TEST_F(CoroutineTests, StoppedActorDropsSuspendedCoroutine)
+{
+    actor_->Receive(ox::MakeMessage<SleepThenCountMessage>(50ms));
+    ASSERT_TRUE(WaitUntil([&] { return actor_->sleeping.load() == 1; }));
+    actor_->Receive(ox::MakeMessage<ox::GoStopActor>());
+
+    ASSERT_TRUE(WaitUntil([&] { return actor_->frame_pool->GetLiveFrameCount() == 0; }));
+    EXPECT_EQ(actor_->counted.load(), 0);
+
+    // Перезапуск не воскрешает уничтоженную корутину
+    actor_->Receive(ox::MakeMessage<ox::GoStartActor>());
+    ASSERT_TRUE(WaitUntil([&] { return actor_->GetState().IsRunning(); }));
+    std::this_thread::sleep_for(100ms);
+    EXPECT_EQ(actor_->counted.load(), 0);
+}
+
+TEST(CoroutineAwaitTests, AwaitOutsideOfAnActorBlocks)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("coroutine-tests", ox::ActorSystemConfig{.thread_count = 1})};
+    const auto squarer{system->CreateActor<SquaringActor>("squarer")};
+    squarer->Receive(ox::MakeMessage<ox::GoStartActor>());
+    ox::ActorRef ref{squarer, system};
+
+    std::optional<int> result;
+    [&]() -> ox::ActorTask {
+        result = (co_await ref.Ask<SquareReply>(ox::MakeMessage<SquareRequest>(7), 5s))->value;
+    }();
+    EXPECT_EQ(result, 49);
+    system->Stop();
+}
+
+} // namespace testing
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/dispatcher.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+} // namespace
+
+struct DispatcherWorkMessage final : ox::Message<DispatcherWorkMessage>
+{
+};
+
+class ThreadRecordingActor final : public ox::Actor
+{
+  public:
+    ThreadRecordingActor(const ox::Executor &executor, const std::string &name, const ox::ActorId id,
+                         std::chrono::milliseconds work)
+        : Actor(executor, name, id), work_{work}
+    {
+    }
+
+    std::atomic<std::size_t> handled{0};
+    std::thread::id thread;
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+        thread = std::this_thread::get_id();
+        std::this_thread::sleep_for(work_);
+        handled.fetch_add(1);
+    }
+
+  private:
+    std::chrono::milliseconds work_;
+};
+
+auto Start(const ox::Sptr<ThreadRecordingActor> &actor) -> void
+{
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+}
+
+TEST(DispatcherTests, BlockingActorDoesNotStallDefaultDispatcher)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("dispatcher-tests", ox::ActorSystemConfig{.thread_count = 1})};
+
+    const auto blocking{system->CreateActor<ThreadRecordingActor>(
+        ox::ActorOptions{.dispatcher = std::string{ox::kBlockingDispatcher}}, "blocking", 500ms)};
+    const auto fast{system->CreateActor<ThreadRecordingActor>("fast", 0ms)};
+    Start(blocking);
+    Start(fast);
+
+    blocking->Receive(ox::MakeMessage<DispatcherWorkMessage>());
+    std::this_thread::sleep_for(20ms);
+    // Единственный поток основного пула свободен, пока блокирующий актор спит
+    const auto started{std::chrono::steady_clock::now()};
+    fast->Receive(ox::MakeMessage<DispatcherWorkMessage>());
+    ASSERT_TRUE(WaitUntil([&] { return fast->handled.load() == 1; }));
+    EXPECT_LT(std::chrono::steady_clock::now() - started, 400ms);
+    EXPECT_EQ(blocking->handled.load(), 0u);
+
+    ASSERT_TRUE(WaitUntil([&] { return blocking->handled.load() == 1; }));
+    EXPECT_NE(blocking->thread, fast->thread);
+    system->Stop();
+}
+
+TEST(DispatcherTests, PinnedDispatcherGivesEveryActorItsOwnThread)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "dispatcher-tests",
+        ox::ActorSystemConfig{.thread_count = 1,
+                              .dispatchers = {{.name = "pinned", .kind = ox::DispatcherKind::PinnedThread}}})};
+    auto *pinned{system->GetDispatcher("pinned")};
+    ASSERT_NE(pinned, nullptr);
+    EXPECT_EQ(pinned->GetThreadCount(), 0u);
+
+    std::vector<ox::Sptr<ThreadRecordingActor>> actors;
+    for (int i{0}; i < 3; ++i)
+    {
+        actors.push_back(system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "pinned"},
+                                                                   "pinned-" + std::to_string(i), 0ms));
+        Start(actors.back());
+        actors.back()->Receive(ox::MakeMessage<DispatcherWorkMessage>());
+    }
+    EXPECT_EQ(pinned->GetThreadCount(), 3u);
+    ASSERT_TRUE(WaitUntil([&] {
+        return std::all_of(actors.begin(), actors.end(), [](const auto &actor) { return actor->handled.load() == 1; });
+    }));
+
+    std::set<std::thread::id> threads;
+    for (const auto &actor : actors)
+    {
+        threads.insert(actor->thread);
+    }
+    EXPECT_EQ(threads.size(), 3u);
+    system->Stop();
+}
+
+TEST(DispatcherTests, PinnedThreadIsReusedAfterItsActorIsGone)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "dispatcher-tests",
+        ox::ActorSystemConfig{.thread_count = 1,
+                              .dispatchers = {{.name = "pinned", .kind = ox::DispatcherKind::PinnedThread}}})};
+    auto *pinned{system->GetDispatcher("pinned")};
+    ASSERT_NE(pinned, nullptr);
+
+    // Акторы создаются и останавливаются по одному: поток освободившегося актора достаётся следующему
+    std::set<std::thread::id> threads;
+    for (int i{0}; i < 20; ++i)
+    {
+        ox::Wptr<ThreadRecordingActor> weak;
+        {
+            const auto actor{system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "pinned"},
+                                                                       "churned-" + std::to_string(i), 0ms)};
+            weak = actor;
+            Start(actor);
+            actor->Receive(ox::MakeMessage<DispatcherWorkMessage>());
+            ASSERT_TRUE(WaitUntil([&] { return actor->handled.load() == 1; }));
+            threads.insert(actor->thread);
+            actor->Receive(ox::MakeMessage<ox::GoStopActor>());
+        }
+        ASSERT_TRUE(WaitUntil([&] { return weak.expired(); }));
+    }
+    EXPECT_EQ(pinned->GetThreadCount(), 1u);
+    EXPECT_EQ(threads.size(), 1u);
+
+    // Пока первый актор жив, второй получает собственный поток
+    const auto first{
+        system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "pinned"}, "first", 0ms)};
+    const auto second{
+        system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "pinned"}, "second", 0ms)};
+    EXPECT_EQ(pinned->GetThreadCount(), 2u);
+    system->Stop();
+}
+
+TEST(DispatcherTests, ThreadPoolDispatcherStartsOnFirstUse)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "dispatcher-tests",
+        ox::ActorSystemConfig{.thread_count = 1, .dispatchers = {{.name = "io", .thread_count = 3}}})};
+    auto *pool{system->GetDispatcher("io")};
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->GetThreadCount(), 0u);
+
+    const auto first{system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "io"}, "first", 0ms)};
+    const auto second{system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "io"}, "second", 0ms)};
+    EXPECT_EQ(pool->GetThreadCount(), 3u);
+    EXPECT_NE(system->GetDispatcher(ox::kBlockingDispatcher), nullptr);
+    system->Stop();
+}
+
+TEST(DispatcherTests, UnknownDispatcherIsRejected)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("dispatcher-tests", 1)};
+    EXPECT_EQ(system->GetDispatcher("missing"), nullptr);
+    EXPECT_THROW((void)system->CreateActor<ThreadRecordingActor>(ox::ActorOptions{.dispatcher = "missing"}, "actor",
+                                                                 0ms),
+                 std::invalid_argument);
+    system->Stop();
+}
+
+} // namespace testing
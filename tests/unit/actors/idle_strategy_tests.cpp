@@ -0,0 +1,180 @@
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/idle_strategy.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(100us);
+    }
+    return true;
+}
+
+// Number of Idle calls until the backoff asks to park, capped for strategies that never do.
+auto CountPollsBeforePark(ox::IdleBackoff &backoff) -> std::size_t
+{
+    std::size_t polls{0};
+    while (!backoff.Idle() && polls < 100'000)
+    {
+        ++polls;
+    }
+    return polls;
+}
+} // namespace
+
+struct IdlePingMessage final : ox::Message<IdlePingMessage>
+{
+};
+
+class CountingActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    std::atomic<std::size_t> handled{0};
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+        handled.fetch_add(1);
+    }
+};
+
+TEST(IdleStrategyTests, BackoffFollowsStrategy)
+{
+    ox::IdleCounters counters;
+
+    ox::IdleBackoff block{{.kind = ox::IdleStrategyKind::Block}, counters};
+    EXPECT_EQ(CountPollsBeforePark(block), 0u);
+
+    ox::IdleBackoff spin{{.kind = ox::IdleStrategyKind::Spin, .spin_count = 10}, counters};
+    EXPECT_EQ(CountPollsBeforePark(spin), 10u);
+
+    ox::IdleBackoff backoff{{.kind = ox::IdleStrategyKind::SpinYieldPark, .spin_count = 10, .yield_count = 5},
+                            counters};
+    EXPECT_EQ(CountPollsBeforePark(backoff), 15u);
+    // После парковки отсчёт начинается заново
+    EXPECT_EQ(CountPollsBeforePark(backoff), 15u);
+
+    ox::IdleBackoff busy_poll{{.kind = ox::IdleStrategyKind::BusyPoll}, counters};
+    EXPECT_EQ(CountPollsBeforePark(busy_poll), 100'000u);
+
+    EXPECT_EQ(counters.GetStats().parks, 4u);
+    EXPECT_EQ(counters.GetStats().wakeups_avoided, 0u);
+}
+
+TEST(IdleStrategyTests, WorkFoundWhileSpinningCountsAsAvoidedWakeup)
+{
+    ox::IdleCounters counters;
+    ox::IdleBackoff backoff{{.kind = ox::IdleStrategyKind::Spin, .spin_count = 10}, counters};
+
+    backoff.Busy();
+    EXPECT_EQ(counters.GetStats().wakeups_avoided, 0u);
+
+    EXPECT_FALSE(backoff.Idle());
+    EXPECT_FALSE(backoff.Idle());
+    backoff.Busy();
+    EXPECT_EQ(counters.GetStats().wakeups_avoided, 1u);
+
+    // Работа сразу после парковки не считается сэкономленным пробуждением
+    EXPECT_EQ(CountPollsBeforePark(backoff), 10u);
+    backoff.Busy();
+    EXPECT_EQ(counters.GetStats().wakeups_avoided, 1u);
+    EXPECT_EQ(counters.GetStats().parks, 1u);
+}
+
+TEST(IdleStrategyTests, RunIoContextReturnsWhenWorkRunsOut)
+{
+    for (const auto kind : {ox::IdleStrategyKind::Block, ox::IdleStrategyKind::Spin,
+                            ox::IdleStrategyKind::SpinYieldPark, ox::IdleStrategyKind::BusyPoll})
+    {
+        boost::asio::io_context context;
+        auto guard{boost::asio::make_work_guard(context)};
+        ox::IdleCounters counters;
+        std::atomic<std::size_t> handled{0};
+
+        std::jthread worker{[&] { ox::RunIoContext(context, {.kind = kind, .spin_count = 100}, counters); }};
+        for (int i{0}; i < 10; ++i)
+        {
+            boost::asio::post(context, [&] { handled.fetch_add(1); });
+            std::this_thread::sleep_for(1ms);
+        }
+        guard.reset();
+        worker.join();
+
+        EXPECT_EQ(handled.load(), 10u);
+        EXPECT_TRUE(context.stopped());
+    }
+}
+
+TEST(IdleStrategyTests, EverySchedulerDeliversWithEveryStrategy)
+{
+    for (const auto scheduler :
+         {ox::SchedulerKind::SharedQueue, ox::SchedulerKind::WorkStealing, ox::SchedulerKind::Sharded})
+    {
+        for (const auto kind : {ox::IdleStrategyKind::Block, ox::IdleStrategyKind::Spin,
+                                ox::IdleStrategyKind::SpinYieldPark, ox::IdleStrategyKind::BusyPoll})
+        {
+            const auto system{ox::MakeSptr<ox::ActorSystem>(
+                "idle-tests",
+                ox::ActorSystemConfig{.thread_count = 2, .scheduler = scheduler, .idle = {.kind = kind}})};
+            const auto actor{system->CreateActor<CountingActor>("counter")};
+            actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+            for (int i{0}; i < 20; ++i)
+            {
+                actor->Receive(ox::MakeMessage<IdlePingMessage>());
+                std::this_thread::sleep_for(200us);
+            }
+            EXPECT_TRUE(WaitUntil([&] { return actor->handled.load() == 20; }));
+            system->Stop();
+        }
+    }
+}
+
+TEST(IdleStrategyTests, BusyPollNeverParks)
+{
+    for (const auto scheduler :
+         {ox::SchedulerKind::SharedQueue, ox::SchedulerKind::WorkStealing, ox::SchedulerKind::Sharded})
+    {
+        const auto system{ox::MakeSptr<ox::ActorSystem>(
+            "idle-tests", ox::ActorSystemConfig{.thread_count = 1,
+                                                .scheduler = scheduler,
+                                                .idle = {.kind = ox::IdleStrategyKind::BusyPoll}})};
+        const auto actor{system->CreateActor<CountingActor>("counter")};
+        actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+        for (int i{0}; i < 20; ++i)
+        {
+            std::this_thread::sleep_for(200us);
+            actor->Receive(ox::MakeMessage<IdlePingMessage>());
+        }
+        ASSERT_TRUE(WaitUntil([&] { return actor->handled.load() == 20; }));
+
+        const auto stats{system->GetIdleStats()};
+        EXPECT_EQ(stats.parks, 0u);
+        EXPECT_GT(stats.wakeups_avoided, 0u);
+        system->Stop();
+    }
+}
+
+} // namespace testing
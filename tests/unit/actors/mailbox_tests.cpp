@@ -0,0 +1,486 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/mailbox.h>
+#include <oxherdcpp/common/mpsc_queue.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+struct MailboxTestMessage final : ox::Message<MailboxTestMessage>
+{
+    explicit MailboxTestMessage(const std::size_t value) : value{value}
+    {
+    }
+    std::size_t value;
+};
+
+class MailboxCountingActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+    std::vector<std::size_t> received;
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        received.push_back(ox::Cast<MailboxTestMessage>(message)->value);
+    }
+};
+
+TEST(MpscQueueTests, PreservesFifoOrderForSingleProducer)
+{
+    ox::MpscQueue<int> queue;
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_FALSE(queue.TryPop());
+
+    for (int i{0}; i < 100; ++i)
+    {
+        queue.Push(i);
+    }
+    EXPECT_FALSE(queue.IsEmpty());
+
+    for (int i{0}; i < 100; ++i)
+    {
+        const auto value{queue.TryPop()};
+        ASSERT_TRUE(value);
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(MpscQueueTests, DeliversEveryElementFromManyProducers)
+{
+    ox::MpscQueue<std::size_t> queue;
+    constexpr std::size_t kThreads{8};
+    constexpr std::size_t kPerThread{10000};
+
+    std::vector<std::thread> producers;
+    producers.reserve(kThreads);
+    for (std::size_t t{0}; t < kThreads; ++t)
+    {
+        producers.emplace_back([&queue, t] {
+            for (std::size_t i{0}; i < kPerThread; ++i)
+            {
+                queue.Push(t * kPerThread + i);
+            }
+        });
+    }
+
+    std::vector<std::size_t> last_seen(kThreads, 0);
+    std::size_t popped{0};
+    while (popped < kThreads * kPerThread)
+    {
+        if (const auto value{queue.TryPop()})
+        {
+            const auto producer{*value / kPerThread};
+            const auto sequence{*value % kPerThread + 1};
+            EXPECT_GT(sequence, last_seen[producer]) << "Per-producer order must be preserved";
+            last_seen[producer] = sequence;
+            ++popped;
+        }
+    }
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(MpscQueueTests, PushBatchKeepsOrderBetweenSinglePushes)
+{
+    ox::MpscQueue<int> queue;
+    const std::vector<int> batch{1, 2, 3};
+
+    queue.Push(0);
+    queue.PushBatch(batch.begin(), batch.end());
+    queue.PushBatch(batch.end(), batch.end());
+    queue.Push(4);
+
+    for (int i{0}; i < 5; ++i)
+    {
+        const auto value{queue.TryPop()};
+        ASSERT_TRUE(value);
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(MailboxTests, OnlyIdleToScheduledTransitionRequestsScheduling)
+{
+    ox::Mailbox mailbox;
+    EXPECT_FALSE(mailbox.IsScheduled());
+
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).needs_schedule);
+    EXPECT_FALSE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(2)).needs_schedule);
+    EXPECT_TRUE(mailbox.IsScheduled());
+
+    EXPECT_TRUE(mailbox.Dequeue());
+    EXPECT_TRUE(mailbox.Dequeue());
+    EXPECT_FALSE(mailbox.Dequeue());
+
+    EXPECT_FALSE(mailbox.CompleteTurn()) << "Nothing is pending, owner must go idle";
+    EXPECT_FALSE(mailbox.IsScheduled());
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(3)).needs_schedule);
+}
+
+TEST(MailboxTests, CompleteTurnReschedulesWhenMessagesArePending)
+{
+    ox::Mailbox mailbox;
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).needs_schedule);
+    EXPECT_FALSE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(2)).needs_schedule);
+
+    EXPECT_TRUE(mailbox.Dequeue());
+    EXPECT_TRUE(mailbox.CompleteTurn()) << "A pending message must keep the owner scheduled";
+    EXPECT_TRUE(mailbox.IsScheduled());
+}
+
+TEST(MailboxTests, ActorDrainsBurstWithBatchedTurns)
+{
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<MailboxCountingActor>(io_context.get_executor(), "mailbox",
+                                                        ox::ActorIDGenerator::Generate())};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    io_context.run();
+    io_context.restart();
+
+    constexpr std::size_t kMessages{100};
+    for (std::size_t i{0}; i < kMessages; ++i)
+    {
+        actor->Receive(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+
+    std::size_t turns{0};
+    while (io_context.run_one() > 0)
+    {
+        ++turns;
+    }
+
+    ASSERT_EQ(actor->received.size(), kMessages);
+    for (std::size_t i{0}; i < kMessages; ++i)
+    {
+        EXPECT_EQ(actor->received[i], i);
+    }
+    EXPECT_LT(turns, kMessages) << "Messages must be drained in batches, not one executor hop per message";
+    EXPECT_GE(turns, 1u);
+}
+
+TEST(MailboxTests, ThroughputBoundsMessagesPerTurn)
+{
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<MailboxCountingActor>(io_context.get_executor(), "throughput",
+                                                        ox::ActorIDGenerator::Generate())};
+    actor->ApplyOptions(ox::ActorOptions{.throughput = 10});
+    EXPECT_EQ(actor->GetThroughput(), 10u);
+
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    io_context.run();
+    io_context.restart();
+
+    for (std::size_t i{0}; i < 100; ++i)
+    {
+        actor->Receive(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+
+    std::size_t turns{0};
+    while (io_context.run_one() > 0)
+    {
+        ++turns;
+    }
+    EXPECT_EQ(actor->received.size(), 100u);
+    EXPECT_EQ(turns, 10u) << "Each turn must yield after exactly 'throughput' messages";
+}
+
+TEST(MailboxTests, EnqueueBatchRequestsSchedulingOnce)
+{
+    ox::Mailbox mailbox;
+    std::vector<ox::MPtr<ox::BaseMessage>> batch;
+    for (std::size_t i{0}; i < 3; ++i)
+    {
+        batch.push_back(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+    batch.push_back(ox::MakeMessage<ox::GoStopActor>());
+
+    ASSERT_TRUE(mailbox.CanEnqueueBatch());
+    EXPECT_TRUE(mailbox.EnqueueBatch(batch));
+    EXPECT_EQ(mailbox.GetSize(), 3u);
+    EXPECT_FALSE(batch.front()) << "Messages are moved out of the batch";
+
+    std::vector<ox::MPtr<ox::BaseMessage>> next{ox::MakeMessage<MailboxTestMessage>(3)};
+    EXPECT_FALSE(mailbox.EnqueueBatch(next)) << "The owner is already scheduled";
+
+    EXPECT_TRUE(mailbox.Dequeue()->IsA<ox::GoStopActor>());
+    for (std::size_t i{0}; i < 4; ++i)
+    {
+        EXPECT_EQ(ox::Cast<MailboxTestMessage>(mailbox.Dequeue())->value, i);
+    }
+    EXPECT_FALSE(mailbox.Dequeue());
+}
+
+TEST(MailboxTests, ActorReceivesBatchInOneTurn)
+{
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<MailboxCountingActor>(io_context.get_executor(), "batch",
+                                                        ox::ActorIDGenerator::Generate())};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    io_context.run();
+    io_context.restart();
+
+    std::vector<ox::MPtr<MailboxTestMessage>> batch;
+    for (std::size_t i{0}; i < 50; ++i)
+    {
+        batch.push_back(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+    ox::ActorRef ref{actor, {}};
+    ref.TellBatch(batch.begin(), batch.end());
+
+    std::size_t turns{0};
+    while (io_context.run_one() > 0)
+    {
+        ++turns;
+    }
+    ASSERT_EQ(actor->received.size(), 50u);
+    for (std::size_t i{0}; i < 50; ++i)
+    {
+        EXPECT_EQ(actor->received[i], i);
+    }
+    EXPECT_EQ(turns, 1u) << "A batch within the throughput must be drained in a single turn";
+}
+
+TEST(MailboxTests, BoundedMailboxTakesBatchMessageByMessage)
+{
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<MailboxCountingActor>(io_context.get_executor(), "bounded-batch",
+                                                        ox::ActorIDGenerator::Generate())};
+    actor->ApplyOptions(ox::ActorOptions{
+        .mailbox = ox::MailboxConfig{.capacity = 2, .overflow_policy = ox::OverflowPolicy::DropNewest}});
+
+    std::vector<ox::MPtr<ox::BaseMessage>> batch;
+    for (std::size_t i{0}; i < 5; ++i)
+    {
+        batch.push_back(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+    EXPECT_EQ(actor->ReceiveBatch(batch), 2u);
+    EXPECT_EQ(actor->GetMailbox().GetDroppedCount(), 3u);
+}
+
+TEST(MailboxTests, UnsetOptionsFallBackToDefaults)
+{
+    const auto merged{ox::MergeActorOptions(ox::ActorOptions{.throughput = 0, .throughput_deadline = 5ms},
+                                            ox::ActorOptions{.throughput = 32, .throughput_deadline = 1ms})};
+    EXPECT_EQ(merged.throughput, 32u);
+    EXPECT_EQ(merged.throughput_deadline, 5ms);
+}
+
+TEST(MailboxTests, DropNewestRejectsWhenFull)
+{
+    ox::Mailbox mailbox;
+    mailbox.Configure(ox::MailboxConfig{.capacity = 2, .overflow_policy = ox::OverflowPolicy::DropNewest});
+
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).accepted);
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(2)).accepted);
+    const auto result{mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(3))};
+    EXPECT_FALSE(result.accepted);
+    EXPECT_FALSE(result.rejected) << "Dropped messages are not handed back";
+    EXPECT_EQ(mailbox.GetSize(), 2u);
+    EXPECT_EQ(mailbox.GetDroppedCount(), 1u);
+
+    EXPECT_EQ(ox::Cast<MailboxTestMessage>(mailbox.Dequeue())->value, 1u);
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(4)).accepted) << "Space must be reusable";
+}
+
+TEST(MailboxTests, DropOldestKeepsNewestMessages)
+{
+    ox::Mailbox mailbox;
+    mailbox.Configure(ox::MailboxConfig{.capacity = 2, .overflow_policy = ox::OverflowPolicy::DropOldest});
+
+    for (std::size_t i{1}; i <= 4; ++i)
+    {
+        EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(i)).accepted);
+    }
+    EXPECT_EQ(ox::Cast<MailboxTestMessage>(mailbox.Dequeue())->value, 3u);
+    EXPECT_EQ(ox::Cast<MailboxTestMessage>(mailbox.Dequeue())->value, 4u);
+    EXPECT_FALSE(mailbox.Dequeue());
+    EXPECT_EQ(mailbox.GetDroppedCount(), 2u);
+}
+
+TEST(MailboxTests, DropOldestStaysBoundedWhileConsumerIsStalled)
+{
+    constexpr std::size_t kCapacity{8};
+    constexpr std::size_t kTells{10'000};
+    // io_context не запускается: потребитель стоит, а производитель продолжает слать
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<MailboxCountingActor>(io_context.get_executor(), "stalled",
+                                                        ox::ActorIDGenerator::Generate())};
+    actor->ApplyOptions(ox::ActorOptions{
+        .mailbox = ox::MailboxConfig{.capacity = kCapacity, .overflow_policy = ox::OverflowPolicy::DropOldest}});
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+
+    ox::ActorRef ref{actor, {}};
+    std::size_t max_size{0};
+    for (std::size_t i{0}; i < kTells; ++i)
+    {
+        ref.Tell(ox::MakeMessage<MailboxTestMessage>(i));
+        max_size = std::max(max_size, actor->GetMailbox().GetSize());
+    }
+    const auto hard_cap{kCapacity * ox::kDropOldestHardCapFactor};
+    EXPECT_LE(max_size, hard_cap);
+    EXPECT_EQ(actor->GetMailbox().GetDroppedCount(), kTells - hard_cap);
+
+    std::vector<ox::MPtr<ox::BaseMessage>> batch;
+    for (std::size_t i{0}; i < 100; ++i)
+    {
+        batch.push_back(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+    ref.TellBatch(batch);
+    EXPECT_LE(actor->GetMailbox().GetSize(), hard_cap) << "Batches respect the cap too";
+
+    io_context.run();
+    EXPECT_EQ(actor->received.size(), kCapacity) << "The consumer still discards down to the capacity";
+}
+
+TEST(MailboxTests, RejectToDeadLettersHandsMessageBack)
+{
+    ox::Mailbox mailbox;
+    mailbox.Configure(ox::MailboxConfig{.capacity = 1, .overflow_policy = ox::OverflowPolicy::RejectToDeadLetters});
+
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).accepted);
+    const auto rejected_message{ox::MakeMessage<MailboxTestMessage>(2)};
+    const auto result{mailbox.Enqueue(rejected_message)};
+    EXPECT_FALSE(result.accepted);
+    EXPECT_EQ(result.rejected.get(), rejected_message.get());
+}
+
+TEST(MailboxTests, BlockedProducerResumesWhenConsumerFreesSpace)
+{
+    ox::Mailbox mailbox;
+    mailbox.Configure(ox::MailboxConfig{
+        .capacity = 1, .overflow_policy = ox::OverflowPolicy::BlockProducer, .block_timeout = 5s});
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).accepted);
+
+    std::atomic<bool> accepted{false};
+    std::thread producer{[&] { accepted = mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(2)).accepted; }};
+
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(accepted.load()) << "Producer must wait while the mailbox is full";
+    EXPECT_TRUE(mailbox.Dequeue());
+    producer.join();
+
+    EXPECT_TRUE(accepted.load());
+    EXPECT_EQ(ox::Cast<MailboxTestMessage>(mailbox.Dequeue())->value, 2u);
+}
+
+TEST(MailboxTests, BlockedProducerGivesUpAfterTimeout)
+{
+    ox::Mailbox mailbox;
+    mailbox.Configure(ox::MailboxConfig{
+        .capacity = 1, .overflow_policy = ox::OverflowPolicy::BlockProducer, .block_timeout = 10ms});
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).accepted);
+
+    const auto result{mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(2))};
+    EXPECT_FALSE(result.accepted);
+    EXPECT_TRUE(result.rejected) << "Timed out messages go to the dead letters";
+}
+
+TEST(MailboxTests, TryTellReportsOverflowAndFeedsDeadLetters)
+{
+    class BlockingActor final : public ox::Actor
+    {
+      public:
+        using Actor::Actor;
+        std::atomic<bool> entered{false};
+        std::atomic<bool> release{false};
+
+      protected:
+        void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+        {
+            entered = true;
+            while (!release.load())
+            {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    const auto system{ox::MakeSptr<ox::ActorSystem>("mailbox-tests", 1)};
+    const ox::ActorOptions options{
+        .mailbox = ox::MailboxConfig{.capacity = 2, .overflow_policy = ox::OverflowPolicy::RejectToDeadLetters}};
+    const auto actor{system->CreateActor<BlockingActor>(options, "bounded")};
+    ox::ActorRef ref{actor, system};
+
+    ref.Tell(ox::MakeMessage<ox::GoStartActor>());
+    ref.Tell(ox::MakeMessage<MailboxTestMessage>(0));
+    while (!actor->entered.load())
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_TRUE(ref.TryTell(ox::MakeMessage<MailboxTestMessage>(1)));
+    EXPECT_TRUE(ref.TryTell(ox::MakeMessage<MailboxTestMessage>(2)));
+    for (std::size_t i{3}; i < 10; ++i)
+    {
+        EXPECT_FALSE(ref.TryTell(ox::MakeMessage<MailboxTestMessage>(i)));
+    }
+    actor->release = true;
+
+    const auto deadline{std::chrono::steady_clock::now() + 2s};
+    while (system->GetDeadLetterCount() < 7 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(system->GetDeadLetterCount(), 7u);
+    EXPECT_EQ(actor->GetMailbox().GetDroppedCount(), 7u);
+    system->Stop();
+}
+
+TEST(MailboxTests, SystemLaneIsDrainedBeforeUserLane)
+{
+    ox::Mailbox mailbox;
+    mailbox.Configure(ox::MailboxConfig{.capacity = 1, .overflow_policy = ox::OverflowPolicy::DropNewest});
+
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<MailboxTestMessage>(1)).accepted);
+    EXPECT_TRUE(mailbox.Enqueue(ox::MakeMessage<ox::GoStopActor>()).accepted)
+        << "System messages are not subject to the user lane capacity";
+    EXPECT_EQ(mailbox.GetSize(), 1u);
+
+    EXPECT_TRUE(mailbox.Dequeue()->IsA<ox::GoStopActor>());
+    EXPECT_TRUE(mailbox.Dequeue()->IsA<MailboxTestMessage>());
+    EXPECT_FALSE(mailbox.Dequeue());
+}
+
+TEST(MailboxTests, StopOvertakesUserBacklog)
+{
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<MailboxCountingActor>(io_context.get_executor(), "backlog",
+                                                        ox::ActorIDGenerator::Generate())};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    io_context.run();
+    io_context.restart();
+
+    for (std::size_t i{0}; i < 1000; ++i)
+    {
+        actor->Receive(ox::MakeMessage<MailboxTestMessage>(i));
+    }
+    actor->Receive(ox::MakeMessage<ox::GoStopActor>());
+
+    ASSERT_GT(io_context.run_one(), 0u);
+    EXPECT_TRUE(actor->GetState().IsStopped()) << "Stop must take effect in the first turn";
+    EXPECT_LT(actor->received.size(), 1000u);
+
+    io_context.run();
+    EXPECT_TRUE(actor->received.empty()) << "Backlog must not be processed once the actor is stopped";
+}
+
+} // namespace testing
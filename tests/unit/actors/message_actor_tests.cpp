@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <new>
+#include <sstream>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
@@ -33,6 +37,28 @@ struct LargeMessage final : ox::Message<LargeMessage>
     std::array<char, 4096> payload{};
 };
 
+// Сообщение для тестов резервирования, лимитов и возврата памяти пула
+struct LimitedTestMessage final : ox::Message<LimitedTestMessage>
+{
+    std::array<char, 64> payload{};
+};
+
+// Сообщение, которое никогда не разделяется между потоками: счётчик ссылок без атомарных RMW
+struct ConfinedTestMessage final : ox::Message<ConfinedTestMessage>
+{
+    static constexpr bool kThreadConfined{true};
+
+    std::atomic<int> *destructor_counter_{nullptr};
+
+    explicit ConfinedTestMessage(std::atomic<int> &counter) : destructor_counter_{&counter}
+    {
+    }
+    ~ConfinedTestMessage() override
+    {
+        ++*destructor_counter_;
+    }
+};
+
 // Сообщение для отслеживания вызова деструктора через внешний счётчик.
 struct DestructorTrackingMessage final : ox::Message<DestructorTrackingMessage>
 {
@@ -65,6 +91,8 @@ class MessageActorTests : public Test
         ox::ReleaseMessagePoolMemory<ReuseTestMessage>();
         ox::ReleaseMessagePoolMemory<DestructorTrackingMessage>();
         ox::ReleaseMessagePoolMemory<LargeMessage>();
+        ox::ReleaseMessagePoolMemory<LimitedTestMessage>();
+        ox::SetMessagePoolLimits<LimitedTestMessage>({});
     }
 
     // Счётчик деструкторов теперь является членом фикстуры.
@@ -223,6 +251,26 @@ TEST_F(MessageActorTests, MessageTypeHashesAreUnique)
     EXPECT_EQ(id_destructor, ox::GetTypeHash<DestructorTrackingMessage>());
 }
 
+TEST_F(MessageActorTests, MessageTypeIndicesAreDenseAndUnique)
+{
+    const auto index_simple = SimpleTestMessage::GetClassTypeIndex();
+    const auto index_another = AnotherTestMessage::GetClassTypeIndex();
+    const auto index_destructor = DestructorTrackingMessage::GetClassTypeIndex();
+
+    // Индексы разных типов различаются и не выходят за число зарегистрированных типов
+    EXPECT_NE(index_simple, index_another);
+    EXPECT_NE(index_simple, index_destructor);
+    EXPECT_NE(index_another, index_destructor);
+    EXPECT_LT(index_simple, ox::GetMessageTypeCount());
+    EXPECT_LT(index_another, ox::GetMessageTypeCount());
+    EXPECT_LT(index_destructor, ox::GetMessageTypeCount());
+
+    // Индекс стабилен в пределах процесса и совпадает у экземпляра и класса
+    EXPECT_EQ(SimpleTestMessage::GetClassTypeIndex(), index_simple);
+    EXPECT_EQ(ox::MakeMessage<SimpleTestMessage>()->GetTypeIndex(), index_simple);
+    EXPECT_EQ(ox::MakeMessage<AnotherTestMessage>()->GetTypeIndex(), index_another);
+}
+
 // Проверяем, что сообщения одного типа используют общий пул (per-type pool)
 TEST_F(MessageActorTests, SameTypeMessagesSharePool)
 {
@@ -379,7 +427,7 @@ TEST_F(MessageActorTests, MemoryIsReused_FromPool_WhenRecreatingMessages)
         // Держим вторую партию до конца блока, чтобы адреса были валидны во время проверки
     }
 
-    // std::pmr::synchronized_pool_resource обычно переиспользует освобождённые блоки малого размера.
+    // Пул сообщений обычно переиспользует освобождённые блоки малого размера.
     // Чтобы тест был стабильным между реализациями, требуем минимум одно совпадение адресов.
     EXPECT_GE(reused, static_cast<std::size_t>(1));
 }
@@ -438,6 +486,27 @@ TEST_F(MessageActorTests, PoolReusesMemoryBetweenBatches)
 }
 
 // Тесты на корректность копирования и перемещения MPtr (boost::intrusive_ptr)
+TEST_F(MessageActorTests, ThreadConfinedMessagesCountReferencesLikeSharedOnes)
+{
+    static_assert(ox::ThreadConfinedMessage<ConfinedTestMessage>);
+    static_assert(!ox::ThreadConfinedMessage<SimpleTestMessage>);
+    EXPECT_FALSE(ox::MakeMessage<SimpleTestMessage>()->IsThreadConfined());
+
+    auto msg = ox::MakeMessage<ConfinedTestMessage>(destructed_count_);
+    EXPECT_TRUE(msg->IsThreadConfined());
+    EXPECT_EQ(msg->use_count(), 1);
+    {
+        const ox::MPtr<ox::BaseMessage> copy = msg;
+        EXPECT_EQ(msg->use_count(), 2);
+    }
+    EXPECT_EQ(msg->use_count(), 1);
+
+    // Единственную ссылку можно передать другому потоку
+    std::thread consumer{[moved = std::move(msg)]() mutable { moved.reset(); }};
+    consumer.join();
+    EXPECT_EQ(destructed_count_.load(), 1);
+}
+
 TEST_F(MessageActorTests, MPtr_CopyConstruction_IncrementsRefCount)
 {
     const auto m1 = ox::MakeMessage<SimpleTestMessage>();
@@ -570,6 +639,182 @@ TEST_F(MessageActorTests, MPtr_MoveAssignToBase_ReleasesOldAndTransfersNew)
     EXPECT_TRUE(base->IsA<SimpleTestMessage>());
 }
 
+// Сообщения создаются в одном потоке, а освобождаются в другом (типичный путь producer -> actor)
+TEST_F(MessageActorTests, MessagesFreedOnAnotherThreadAreReused)
+{
+    using T = ReuseTestMessage;
+    constexpr std::size_t N = 10 * ox::kPoolThreadCacheCapacity;
+
+    auto &stats = ox::GetMessagePoolStats<T>();
+    const auto base_allocs = stats.allocations.load();
+    const auto base_deallocs = stats.deallocations.load();
+
+    std::vector<ox::MPtr<T>> produced;
+    produced.reserve(N);
+    std::unordered_set<const void *> addresses;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        produced.push_back(ox::MakeMessage<T>());
+        addresses.insert(produced.back().get());
+    }
+
+    // Потребитель освобождает всё; его кэш переполняется и отдаёт блоки в общий список
+    std::thread consumer{[&produced] { produced.clear(); }};
+    consumer.join();
+    EXPECT_EQ(stats.allocations.load(), base_allocs + N);
+    EXPECT_EQ(stats.deallocations.load(), base_deallocs + N);
+
+    // Поток производителя снова получает освобождённые чужим потоком блоки
+    std::size_t reused = 0;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        produced.push_back(ox::MakeMessage<T>());
+        reused += addresses.contains(produced.back().get()) ? 1 : 0;
+    }
+    EXPECT_GE(reused, N - ox::kPoolThreadCacheCapacity);
+}
+
+// Создаёт и освобождает count сообщений в отдельном потоке, чтобы его кэш вернул блоки в пул при выходе
+template <typename T> auto ChurnMessagesOnThread(const std::size_t count) -> void
+{
+    std::thread worker{[count] {
+        std::vector<ox::MPtr<T>> messages;
+        messages.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            messages.push_back(ox::MakeMessage<T>());
+        }
+    }};
+    worker.join();
+}
+
+TEST_F(MessageActorTests, ReservePrePopulatesPool)
+{
+    using T = LimitedTestMessage;
+    EXPECT_EQ(T::GetPoolHeldBytes(), 0u);
+
+    ASSERT_TRUE(ox::ReserveMessagePool<T>(1000));
+    const auto reserved = T::GetPoolHeldBytes();
+    EXPECT_GE(reserved, 1000 * sizeof(T));
+
+    // Зарезервированных блоков хватает с учётом пачки, которую забирает кэш потока
+    ChurnMessagesOnThread<T>(1000 - ox::kPoolTransferBatch);
+    EXPECT_EQ(T::GetPoolHeldBytes(), reserved);
+}
+
+TEST_F(MessageActorTests, TrimReturnsIdleChunksDownToReservation)
+{
+    using T = LimitedTestMessage;
+    ASSERT_TRUE(ox::ReserveMessagePool<T>(10));
+    const auto reserved = T::GetPoolHeldBytes();
+
+    ChurnMessagesOnThread<T>(10'000);
+    const auto peak = T::GetPoolHeldBytes();
+    EXPECT_GT(peak, reserved);
+
+    EXPECT_EQ(ox::TrimMessagePool<T>(), peak - reserved);
+    EXPECT_EQ(T::GetPoolHeldBytes(), reserved);
+    EXPECT_EQ(ox::TrimMessagePool<T>(), 0u);
+}
+
+TEST_F(MessageActorTests, PoolLimitFallsBackToUnpooledBlocks)
+{
+    using T = LimitedTestMessage;
+    ASSERT_TRUE(ox::ReserveMessagePool<T>(1));
+    const auto limit = T::GetPoolHeldBytes();
+    ox::SetMessagePoolLimits<T>({.max_bytes = limit});
+    EXPECT_FALSE(ox::ReserveMessagePool<T>(10'000));
+
+    // Сверх лимита сообщения получают память мимо пула, и пул не растёт
+    auto &stats = ox::GetMessagePoolStats<T>();
+    const auto base_deallocs = stats.deallocations.load();
+    ChurnMessagesOnThread<T>(10'000);
+    EXPECT_EQ(T::GetPoolHeldBytes(), limit);
+    EXPECT_EQ(stats.deallocations.load(), base_deallocs + 10'000);
+}
+
+TEST_F(MessageActorTests, UnpooledBlocksAreFreedRightAway)
+{
+    using T = LimitedTestMessage;
+    ASSERT_TRUE(ox::ReserveMessagePool<T>(1));
+    const auto limit = T::GetPoolHeldBytes();
+    ox::SetMessagePoolLimits<T>({.max_bytes = limit});
+    const auto unpooled_blocks = [] {
+        const auto inventory = ox::GetPoolInventory();
+        return std::ranges::find(inventory, ox::GetTypeName<T>(), &ox::PoolReport::name)->unpooled_blocks;
+    };
+
+    // Сверх лимита каждое сообщение получает ровно один блок мимо кэшей потоков
+    constexpr std::size_t kLive = 1000;
+    std::vector<ox::MPtr<T>> messages;
+    for (std::size_t i = 0; i < kLive; ++i)
+    {
+        messages.push_back(ox::MakeMessage<T>());
+    }
+    const auto pooled = limit / sizeof(T);
+    EXPECT_GT(unpooled_blocks(), 0u);
+    EXPECT_LE(unpooled_blocks(), kLive - pooled + ox::kPoolTransferBatch);
+    EXPECT_EQ(T::GetPoolHeldBytes(), limit);
+
+    // Освобождённые блоки сразу возвращаются в upstream, в том числе из чужого потока
+    std::thread consumer{[&messages] { messages.resize(kLive / 2); }};
+    consumer.join();
+    messages.clear();
+    EXPECT_EQ(unpooled_blocks(), 0u);
+    EXPECT_EQ(T::GetPoolHeldBytes(), limit);
+}
+
+TEST_F(MessageActorTests, PoolLimitCanThrow)
+{
+    using T = LimitedTestMessage;
+    ox::SetMessagePoolLimits<T>({.max_bytes = 1, .on_limit = ox::PoolLimitAction::Throw});
+    EXPECT_THROW(ox::MakeMessage<T>(), std::bad_alloc);
+    EXPECT_EQ(T::GetPoolHeldBytes(), 0u);
+}
+
+TEST_F(MessageActorTests, GlobalPoolLimitCapsEveryPool)
+{
+    using T = LimitedTestMessage;
+    // Ноль означает отсутствие лимита, поэтому лимит на байт больше уже занятого
+    ox::SetGlobalPoolLimit(ox::GetGlobalPoolBytes() + 1);
+    ChurnMessagesOnThread<T>(1000);
+    EXPECT_EQ(T::GetPoolHeldBytes(), 0u);
+    ox::SetGlobalPoolLimit(0);
+
+    ChurnMessagesOnThread<T>(1000);
+    EXPECT_GT(T::GetPoolHeldBytes(), 0u);
+    EXPECT_GT(ox::TrimAllPools(), 0u);
+    EXPECT_EQ(T::GetPoolHeldBytes(), 0u);
+}
+
+TEST_F(MessageActorTests, PoolInventoryListsEveryMessageType)
+{
+    using T = LimitedTestMessage;
+    std::vector<ox::MPtr<T>> messages;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        messages.push_back(ox::MakeMessage<T>());
+    }
+
+    const auto inventory = ox::GetPoolInventory();
+    const auto report = std::ranges::find(inventory, ox::GetTypeName<T>(), &ox::PoolReport::name);
+    ASSERT_NE(report, inventory.end());
+    EXPECT_NE(report->name.find("LimitedTestMessage"), std::string_view::npos);
+    EXPECT_EQ(report->object_size, sizeof(T));
+    EXPECT_GE(report->blocks_out, 100u);
+    EXPECT_EQ(report->held_bytes, T::GetPoolHeldBytes());
+    EXPECT_GE(report->peak_held_bytes, report->held_bytes);
+    if constexpr (ox::kPoolStatsEnabled)
+    {
+        EXPECT_EQ(report->live_objects, 100u);
+    }
+    EXPECT_TRUE(std::ranges::any_of(inventory, [](const auto &other) { return other.name.ends_with("LargeMessage"); }));
+
+    std::ostringstream dump;
+    ox::WritePoolInventory(dump);
+    EXPECT_NE(dump.str().find(report->name), std::string::npos);
+}
+
 TEST_F(MessageActorTests, ConcurrentCreationFromMultipleThreads)
 {
     // Базовые значения статистики для контроля аллокаций/деаллокаций
@@ -0,0 +1,269 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/router.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+constexpr std::size_t kRoutees{4};
+} // namespace
+
+struct JobMessage final : ox::Message<JobMessage>
+{
+    explicit JobMessage(const std::size_t key) : key{key}
+    {
+    }
+    std::size_t key;
+};
+
+struct CrashMessage final : ox::Message<CrashMessage>
+{
+};
+
+// Everything the routees of one test report, indexed by routee
+struct RouteeLog
+{
+    std::array<std::atomic<std::size_t>, kRoutees> jobs{};
+    std::atomic<std::size_t> started{0};
+    std::mutex mutex;
+    std::array<std::set<std::size_t>, kRoutees> keys{};
+};
+
+class WorkerActor final : public ox::Actor
+{
+  public:
+    WorkerActor(const ox::Executor &executor, const std::string &name, const ox::ActorId id, RouteeLog *log,
+                const std::size_t index)
+        : Actor(executor, name, id), log_{log}, index_{index}
+    {
+    }
+
+  protected:
+    void OnStarted() override
+    {
+        log_->started.fetch_add(1);
+    }
+
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        if (ox::Cast<CrashMessage>(message))
+        {
+            throw std::runtime_error{"routee crashed"};
+        }
+        if (const auto job{ox::Cast<JobMessage>(message)})
+        {
+            {
+                std::lock_guard lock{log_->mutex};
+                log_->keys[index_].insert(job->key);
+            }
+            log_->jobs[index_].fetch_add(1);
+        }
+    }
+
+  private:
+    RouteeLog *log_;
+    std::size_t index_;
+};
+
+class RouterTests : public Test
+{
+  protected:
+    void SetUp() override
+    {
+        system_ = ox::MakeSptr<ox::ActorSystem>("router-tests", ox::ActorSystemConfig{.thread_count = 4});
+    }
+
+    void TearDown() override
+    {
+        system_->Stop();
+    }
+
+    auto StartRouter(ox::RouterConfig config) -> ox::Sptr<ox::RouterActor>
+    {
+        config.routee_count = kRoutees;
+        auto router{system_->CreateActor<ox::RouterActor>(
+            "router", std::move(config), [log = &log_](ox::ActorContext &context, const std::size_t index) {
+                auto strategy{ox::MakeUptr<ox::OneForOneStrategy>()};
+                strategy->HandleException<std::runtime_error>(ox::Directive::Restart);
+                return context.SpawnChild<WorkerActor>("worker-" + std::to_string(index), std::move(strategy), log,
+                                                       index);
+            })};
+        router->Receive(ox::MakeMessage<ox::GoStartActor>());
+        EXPECT_TRUE(WaitUntil([&] { return log_.started.load() == kRoutees; }));
+        return router;
+    }
+
+    auto CountJobs() -> std::size_t
+    {
+        std::size_t total{0};
+        for (const auto &jobs : log_.jobs)
+        {
+            total += jobs.load();
+        }
+        return total;
+    }
+
+    ox::Sptr<ox::ActorSystem> system_;
+    RouteeLog log_;
+};
+
+TEST_F(RouterTests, RoundRobinSpreadsEvenly)
+{
+    const auto router{StartRouter(ox::RouterConfig{.strategy = ox::RoutingStrategy::RoundRobin})};
+    auto workers{router->GetRouter()};
+    EXPECT_EQ(workers.GetRouteeCount(), kRoutees);
+
+    for (std::size_t i{0}; i < 400; ++i)
+    {
+        workers.Tell(ox::MakeMessage<JobMessage>(i));
+    }
+    ASSERT_TRUE(WaitUntil([&] { return CountJobs() == 400; }));
+    for (const auto &jobs : log_.jobs)
+    {
+        EXPECT_EQ(jobs.load(), 100u);
+    }
+}
+
+TEST_F(RouterTests, RandomDeliversEverything)
+{
+    const auto router{StartRouter(ox::RouterConfig{.strategy = ox::RoutingStrategy::Random})};
+    auto workers{router->GetRouter()};
+
+    for (std::size_t i{0}; i < 1000; ++i)
+    {
+        workers.Tell(ox::MakeMessage<JobMessage>(i));
+    }
+    ASSERT_TRUE(WaitUntil([&] { return CountJobs() == 1000; }));
+    for (const auto &jobs : log_.jobs)
+    {
+        EXPECT_GT(jobs.load(), 0u);
+    }
+}
+
+TEST_F(RouterTests, ConsistentHashKeepsKeysOnOneRoutee)
+{
+    const auto router{StartRouter(ox::RouterConfig{
+        .strategy = ox::RoutingStrategy::ConsistentHash,
+        .hash_key = [](const ox::BaseMessage &message) { return static_cast<const JobMessage &>(message).key; }})};
+    auto workers{router->GetRouter()};
+
+    for (std::size_t round{0}; round < 5; ++round)
+    {
+        for (std::size_t key{0}; key < 100; ++key)
+        {
+            workers.Tell(ox::MakeMessage<JobMessage>(key));
+        }
+    }
+    ASSERT_TRUE(WaitUntil([&] { return CountJobs() == 500; }));
+    std::size_t distinct_keys{0};
+    for (const auto &keys : log_.keys)
+    {
+        EXPECT_FALSE(keys.empty()) << "Keys must be spread over the ring";
+        distinct_keys += keys.size();
+    }
+    EXPECT_EQ(distinct_keys, 100u) << "Every key must stay on a single routee";
+}
+
+TEST_F(RouterTests, ConsistentHashRequiresKey)
+{
+    EXPECT_THROW(ox::RoutingLogic{ox::RouterConfig{.strategy = ox::RoutingStrategy::ConsistentHash}},
+                 std::invalid_argument);
+}
+
+TEST_F(RouterTests, RestartedRouteeTakesOverItsSlot)
+{
+    const auto router{StartRouter(ox::RouterConfig{.strategy = ox::RoutingStrategy::RoundRobin})};
+    auto workers{router->GetRouter()};
+    ox::ActorRef router_ref{router, system_};
+
+    workers.Tell(ox::MakeMessage<CrashMessage>());
+    ASSERT_TRUE(WaitUntil([&] { return log_.started.load() == kRoutees + 1; }))
+        << "Supervision strategy must restart the routee";
+
+    // Через почтовый ящик роутера: сообщения идут после обработки сбоя
+    for (std::size_t i{0}; i < 8; ++i)
+    {
+        router_ref.Tell(ox::MakeMessage<JobMessage>(i));
+    }
+    ASSERT_TRUE(WaitUntil([&] { return CountJobs() == 8; }));
+    for (const auto &jobs : log_.jobs)
+    {
+        EXPECT_EQ(jobs.load(), 2u);
+    }
+    EXPECT_EQ(workers.GetRouteeCount(), kRoutees);
+}
+
+TEST_F(RouterTests, UnstartedRouterFeedsDeadLetters)
+{
+    const auto router{system_->CreateActor<ox::RouterActor>(
+        "idle-router", ox::RouterConfig{}, [](ox::ActorContext &context, std::size_t) {
+            return context.SpawnChild<WorkerActor>("worker", nullptr, nullptr, 0);
+        })};
+    auto workers{router->GetRouter()};
+
+    EXPECT_FALSE(workers.TryTell(ox::MakeMessage<JobMessage>(0)));
+    EXPECT_TRUE(WaitUntil([&] { return system_->GetDeadLetterCount() == 1; }));
+}
+
+TEST(RoutingLogicTests, SmallestMailboxAvoidsBacklog)
+{
+    boost::asio::io_context io_context;
+    RouteeLog log;
+    ox::RoutingLogic logic{ox::RouterConfig{.strategy = ox::RoutingStrategy::SmallestMailbox, .routee_count = 2}};
+    std::vector<ox::Sptr<WorkerActor>> routees;
+    for (std::size_t index{0}; index < 2; ++index)
+    {
+        routees.push_back(ox::MakeSptr<WorkerActor>(io_context.get_executor(), "worker",
+                                                    ox::ActorIDGenerator::Generate(), &log, index));
+        logic.SetRoutee(index, routees.back());
+    }
+    for (std::size_t i{0}; i < 5; ++i)
+    {
+        routees[0]->Receive(ox::MakeMessage<JobMessage>(i));
+    }
+
+    EXPECT_TRUE(logic.Route(ox::MakeMessage<JobMessage>(5)).accepted);
+    EXPECT_EQ(routees[0]->GetMailbox().GetSize(), 5u);
+    EXPECT_EQ(routees[1]->GetMailbox().GetSize(), 1u);
+
+    logic.SetRoutee(1, nullptr);
+    EXPECT_EQ(logic.GetRouteeCount(), 1u);
+    EXPECT_TRUE(logic.Route(ox::MakeMessage<JobMessage>(6)).accepted);
+    EXPECT_EQ(routees[0]->GetMailbox().GetSize(), 6u) << "Slots out of routing must be skipped";
+}
+
+} // namespace testing
@@ -0,0 +1,199 @@
+#include <atomic>
+#include <optional>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/sharded_runtime.h>
+#include <oxherdcpp/common/spsc_ring.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+auto ShardOf(const ox::Executor &executor) -> std::optional<std::size_t>
+{
+    const auto *sharded{executor.target<ox::ShardedRuntime::executor_type>()};
+    if (sharded == nullptr)
+    {
+        return std::nullopt;
+    }
+    return sharded->GetShard();
+}
+} // namespace
+
+TEST(SpscRingTests, PreservesOrderAndRejectsWhenFull)
+{
+    ox::SpscRing<int, 4> ring;
+    EXPECT_FALSE(ring.TryPop());
+
+    for (int i{0}; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.TryPush(i));
+    }
+    EXPECT_FALSE(ring.TryPush(4));
+
+    EXPECT_EQ(ring.TryPop(), 0);
+    EXPECT_TRUE(ring.TryPush(4));
+    for (int i{1}; i < 5; ++i)
+    {
+        EXPECT_EQ(ring.TryPop(), i);
+    }
+    EXPECT_FALSE(ring.TryPop());
+}
+
+TEST(ShardedRuntimeTests, TasksRunOnTheirShard)
+{
+    ox::ShardedRuntime runtime{3};
+    EXPECT_EQ(runtime.GetShardCount(), 3u);
+    EXPECT_FALSE(runtime.GetCurrentShard());
+
+    std::atomic<std::size_t> mismatches{0};
+    std::atomic<std::size_t> executed{0};
+    for (std::size_t shard{0}; shard < 3; ++shard)
+    {
+        const boost::asio::any_io_executor executor{runtime.GetExecutor(shard)};
+        for (int i{0}; i < 100; ++i)
+        {
+            boost::asio::post(executor, [&, shard] {
+                if (runtime.GetCurrentShard() != shard)
+                {
+                    mismatches.fetch_add(1);
+                }
+                executed.fetch_add(1);
+            });
+        }
+    }
+    ASSERT_TRUE(WaitUntil([&] { return executed.load() == 300; }));
+    EXPECT_EQ(mismatches.load(), 0u);
+    // Все задачи пришли из чужого потока, кольца между шардами не использовались
+    EXPECT_EQ(runtime.GetCrossShardCount(), 0u);
+}
+
+TEST(ShardedRuntimeTests, CrossShardWorkGoesThroughRings)
+{
+    ox::ShardedRuntime runtime{2};
+    const auto source{runtime.GetExecutor(0)};
+    const auto destination{runtime.GetExecutor(1)};
+
+    constexpr std::size_t kTasks{1000};
+    std::atomic<std::size_t> executed{0};
+    std::atomic<std::size_t> mismatches{0};
+    boost::asio::post(source, [&] {
+        for (std::size_t i{0}; i < kTasks; ++i)
+        {
+            boost::asio::post(destination, [&] {
+                if (runtime.GetCurrentShard() != 1u)
+                {
+                    mismatches.fetch_add(1);
+                }
+                executed.fetch_add(1);
+            });
+        }
+    });
+    ASSERT_TRUE(WaitUntil([&] { return executed.load() == kTasks; }));
+    EXPECT_EQ(mismatches.load(), 0u);
+    EXPECT_GT(runtime.GetCrossShardCount(), 0u);
+}
+
+class ShardProbeActor final : public ox::Actor
+{
+  public:
+    static constexpr std::size_t kUnknownShard{~std::size_t{0}};
+
+    ShardProbeActor(const ox::Executor &executor, const std::string &name, const ox::ActorId id,
+                    std::atomic<std::size_t> *reported_shard)
+        : Actor(executor, name, id), reported_shard_{reported_shard}
+    {
+    }
+
+    struct SpawnMessage final : ox::Message<SpawnMessage>
+    {
+        explicit SpawnMessage(std::atomic<std::size_t> *child_shard) : child_shard{child_shard}
+        {
+        }
+        std::atomic<std::size_t> *child_shard;
+    };
+
+    struct ReportMessage final : ox::Message<ReportMessage>
+    {
+    };
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        if (const auto spawn{ox::Cast<SpawnMessage>(message)})
+        {
+            auto child{GetContext().SpawnChild<ShardProbeActor>("child", nullptr, spawn->child_shard)};
+            child.Tell(ox::MakeMessage<ox::GoStartActor>());
+            child.Tell(ox::MakeMessage<ReportMessage>());
+        }
+        else if (ox::Cast<ReportMessage>(message))
+        {
+            reported_shard_->store(ShardOf(GetExecutor()).value_or(kUnknownShard));
+        }
+    }
+
+  private:
+    std::atomic<std::size_t> *reported_shard_;
+};
+
+auto ReportShard(const ox::Sptr<ShardProbeActor> &actor, const std::atomic<std::size_t> &reported) -> std::size_t
+{
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    actor->Receive(ox::MakeMessage<ShardProbeActor::ReportMessage>());
+    EXPECT_TRUE(WaitUntil([&] { return reported.load() != ShardProbeActor::kUnknownShard; }));
+    return reported.load();
+}
+
+TEST(ShardedRuntimeTests, ActorsArePlacedOnShards)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "sharded-tests", ox::ActorSystemConfig{.thread_count = 4, .scheduler = ox::SchedulerKind::Sharded})};
+    EXPECT_EQ(system->GetShardCount(), 4u);
+
+    std::atomic<std::size_t> parent_shard{ShardProbeActor::kUnknownShard};
+    const auto parent{system->CreateActor<ShardProbeActor>(
+        ox::ActorOptions{.placement = ox::ShardPlacement::Explicit, .shard = 6}, "parent", &parent_shard)};
+    EXPECT_EQ(ReportShard(parent, parent_shard), 2u);
+
+    std::atomic<std::size_t> first_shard{ShardProbeActor::kUnknownShard};
+    std::atomic<std::size_t> second_shard{ShardProbeActor::kUnknownShard};
+    const auto first{system->CreateActor<ShardProbeActor>("first", &first_shard)};
+    const auto second{system->CreateActor<ShardProbeActor>("second", &second_shard)};
+    EXPECT_NE(ReportShard(first, first_shard), ReportShard(second, second_shard));
+
+    // Дочерний актор по умолчанию живет на шарде родителя
+    std::atomic<std::size_t> child_shard{ShardProbeActor::kUnknownShard};
+    parent->Receive(ox::MakeMessage<ShardProbeActor::SpawnMessage>(&child_shard));
+    ASSERT_TRUE(WaitUntil([&] { return child_shard.load() != ShardProbeActor::kUnknownShard; }));
+    EXPECT_EQ(child_shard.load(), 2u);
+
+    system->Stop();
+}
+
+} // namespace testing
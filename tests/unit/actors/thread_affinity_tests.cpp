@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/thread_affinity.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+TEST(ThreadAffinityTests, ParsesKernelCpuLists)
+{
+    EXPECT_EQ(ox::ParseCpuList("0-3,8,10-11\n"), (ox::CpuSet{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(ox::ParseCpuList("5"), (ox::CpuSet{5}));
+    EXPECT_EQ(ox::ParseCpuList("3,1-2,2"), (ox::CpuSet{1, 2, 3}));
+    // Битые куски пропускаются
+    EXPECT_EQ(ox::ParseCpuList("x,4-2,7"), (ox::CpuSet{7}));
+    EXPECT_TRUE(ox::ParseCpuList("").empty());
+}
+
+TEST(ThreadAffinityTests, MachineHasAtLeastOneNode)
+{
+    const auto nodes{ox::GetNumaNodes()};
+    ASSERT_FALSE(nodes.empty());
+    EXPECT_FALSE(nodes.front().cpus.empty());
+}
+
+TEST(ThreadAffinityTests, NodesAreLimitedToProcessAffinity)
+{
+    // Как после taskset -c 1,4-5: узел 1 остаётся без CPU и пропадает
+    const std::vector<ox::NumaNode> nodes{
+        {.id = 0, .cpus = {0, 1, 2, 3}}, {.id = 1, .cpus = {6, 7}}, {.id = 2, .cpus = {4, 5}}};
+    const auto restricted{ox::RestrictNumaNodes(nodes, ox::CpuSet{1, 4, 5})};
+    ASSERT_EQ(restricted.size(), 2u);
+    EXPECT_EQ(restricted[0].id, 0u);
+    EXPECT_EQ(restricted[0].cpus, (ox::CpuSet{1}));
+    EXPECT_EQ(restricted[1].id, 2u);
+    EXPECT_EQ(restricted[1].cpus, (ox::CpuSet{4, 5}));
+
+#ifdef __linux__
+    const auto available{ox::GetCurrentThreadAffinity()};
+    for (const auto &node : ox::GetNumaNodes())
+    {
+        for (const auto cpu : node.cpus)
+        {
+            EXPECT_TRUE(std::ranges::find(available, cpu) != available.end()) << cpu;
+        }
+    }
+#endif
+}
+
+TEST(ThreadAffinityTests, ResolvesWorkerCpuSets)
+{
+    const std::vector<ox::NumaNode> nodes{{.id = 0, .cpus = {0, 1}}, {.id = 1, .cpus = {2, 3}}};
+
+    EXPECT_EQ(ox::ResolveWorkerCpuSets({}, 3, nodes), (std::vector<ox::CpuSet>(3)));
+
+    EXPECT_EQ(ox::ResolveWorkerCpuSets({.pinning = ox::WorkerPinning::PerCpu}, 5, nodes),
+              (std::vector<ox::CpuSet>{{0}, {1}, {2}, {3}, {0}}));
+
+    EXPECT_EQ(ox::ResolveWorkerCpuSets({.pinning = ox::WorkerPinning::PerNumaNode}, 4, nodes),
+              (std::vector<ox::CpuSet>{{0, 1}, {0, 1}, {2, 3}, {2, 3}}));
+
+    const ox::WorkerAffinity explicit_sets{.pinning = ox::WorkerPinning::Explicit, .cpu_sets = {{7}, {8, 9}}};
+    EXPECT_EQ(ox::ResolveWorkerCpuSets(explicit_sets, 3, nodes), (std::vector<ox::CpuSet>{{7}, {8, 9}, {7}}));
+}
+
+TEST(ThreadAffinityTests, PinsCurrentThread)
+{
+#ifdef __linux__
+    const auto available{ox::GetCurrentThreadAffinity()};
+    ASSERT_FALSE(available.empty());
+
+    ox::CpuSet pinned;
+    std::jthread{[&] {
+        EXPECT_TRUE(ox::PinCurrentThread({available.front()}));
+        pinned = ox::GetCurrentThreadAffinity();
+    }}.join();
+    EXPECT_EQ(pinned, ox::CpuSet{available.front()});
+#else
+    GTEST_SKIP() << "Thread pinning is only implemented for Linux";
+#endif
+}
+
+class AffinityProbeActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    std::atomic<std::size_t> cpu_count{0};
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+        cpu_count.store(ox::GetCurrentThreadAffinity().size());
+    }
+};
+
+struct AffinityProbeMessage final : ox::Message<AffinityProbeMessage>
+{
+};
+
+TEST(ThreadAffinityTests, ActorSystemPinsWorkers)
+{
+#ifdef __linux__
+    // Одного CPU на воркер хватает на любой машине: лишние воркеры делят CPU по кругу
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "affinity-tests", ox::ActorSystemConfig{.thread_count = 2, .affinity = {.pinning = ox::WorkerPinning::PerCpu}})};
+    const auto actor{system->CreateActor<AffinityProbeActor>("probe")};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+    actor->Receive(ox::MakeMessage<AffinityProbeMessage>());
+
+    const auto deadline{std::chrono::steady_clock::now() + 5s};
+    while (actor->cpu_count.load() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(actor->cpu_count.load(), 1u);
+    system->Stop();
+#else
+    GTEST_SKIP() << "Thread pinning is only implemented for Linux";
+#endif
+}
+
+} // namespace testing
@@ -0,0 +1,269 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_context.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/timing_wheel.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitUntil(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+} // namespace
+
+struct TrimmedPoolMessage final : ox::Message<TrimmedPoolMessage>
+{
+};
+
+struct TimerFiredMessage final : ox::Message<TimerFiredMessage>
+{
+    explicit TimerFiredMessage(const int value = 0) : value{value}
+    {
+    }
+
+    int value;
+};
+
+class TimerTargetActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    std::atomic<std::size_t> handled{0};
+    std::atomic<int> last_value{0};
+    std::atomic<std::int64_t> first_at_ns{0};
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        if (const auto fired{ox::Cast<TimerFiredMessage>(message)})
+        {
+            last_value.store(fired->value);
+        }
+        std::int64_t expected{0};
+        first_at_ns.compare_exchange_strong(expected,
+                                            std::chrono::steady_clock::now().time_since_epoch().count());
+        handled.fetch_add(1);
+    }
+};
+
+// Schedules a periodic message to itself when it starts and cancels it after three deliveries.
+class SelfTickingActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    std::atomic<std::size_t> handled{0};
+    std::atomic<bool> cancelled{false};
+
+  protected:
+    void OnStarted() override
+    {
+        timer_ = GetContext().ScheduleAtFixedRate(1ms, 2ms, ox::MakeMessage<TimerFiredMessage>());
+    }
+
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &) override
+    {
+        if (handled.fetch_add(1) + 1 == 3)
+        {
+            cancelled.store(GetContext().Cancel(timer_));
+        }
+    }
+
+  private:
+    ox::TimerHandle timer_{};
+};
+
+auto Start(const ox::Sptr<ox::Actor> &actor) -> void
+{
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+}
+
+TEST(TimingWheelTests, ScheduleOnceDeliversAfterDelay)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("timer-tests", ox::ActorSystemConfig{.thread_count = 2})};
+    const auto actor{system->CreateActor<TimerTargetActor>("target")};
+    Start(actor);
+
+    const auto scheduled_at{std::chrono::steady_clock::now()};
+    const auto handle{system->ScheduleOnce(20ms, ox::ActorRef{actor, system}, ox::MakeMessage<TimerFiredMessage>(7))};
+    EXPECT_TRUE(handle);
+    EXPECT_EQ(system->GetTimingWheel().GetTimerCount(), 1u);
+
+    ASSERT_TRUE(WaitUntil([&] { return actor->handled.load() == 1; }));
+    const auto fired_at{std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{actor->first_at_ns}}};
+    EXPECT_GE(fired_at - scheduled_at, 20ms);
+    EXPECT_EQ(actor->last_value.load(), 7);
+    EXPECT_EQ(system->GetTimingWheel().GetTimerCount(), 0u);
+    // Один раз сработавший таймер уже не отменить
+    EXPECT_FALSE(system->Cancel(handle));
+    system->Stop();
+}
+
+TEST(TimingWheelTests, CancelledTimerNeverFires)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("timer-tests", ox::ActorSystemConfig{.thread_count = 1})};
+    const auto actor{system->CreateActor<TimerTargetActor>("target")};
+    Start(actor);
+
+    const auto cancelled{
+        system->ScheduleOnce(10ms, ox::ActorRef{actor, system}, ox::MakeMessage<TimerFiredMessage>(1))};
+    system->ScheduleOnce(30ms, ox::ActorRef{actor, system}, ox::MakeMessage<TimerFiredMessage>(2));
+    EXPECT_TRUE(system->Cancel(cancelled));
+    EXPECT_FALSE(system->Cancel(cancelled));
+
+    ASSERT_TRUE(WaitUntil([&] { return actor->handled.load() == 1; }));
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(actor->handled.load(), 1u);
+    EXPECT_EQ(actor->last_value.load(), 2);
+    system->Stop();
+}
+
+TEST(TimingWheelTests, FixedRateRepeatsUntilCancelled)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("timer-tests", ox::ActorSystemConfig{.thread_count = 1})};
+    const auto actor{system->CreateActor<TimerTargetActor>("target")};
+    Start(actor);
+
+    const auto handle{
+        system->ScheduleAtFixedRate(1ms, 2ms, ox::ActorRef{actor, system}, ox::MakeMessage<TimerFiredMessage>())};
+    ASSERT_TRUE(WaitUntil([&] { return actor->handled.load() >= 5; }));
+    EXPECT_TRUE(system->Cancel(handle));
+
+    std::this_thread::sleep_for(10ms);
+    const auto handled{actor->handled.load()};
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(actor->handled.load(), handled);
+    EXPECT_EQ(system->GetTimingWheel().GetTimerCount(), 0u);
+    system->Stop();
+}
+
+TEST(TimingWheelTests, ActorContextSchedulesToSelf)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("timer-tests", ox::ActorSystemConfig{.thread_count = 2})};
+    const auto actor{system->CreateActor<SelfTickingActor>("ticker")};
+    Start(actor);
+
+    ASSERT_TRUE(WaitUntil([&] { return actor->cancelled.load(); }));
+    std::this_thread::sleep_for(20ms);
+    // Сообщение, собранное к доставке до отмены, ещё может прийти
+    EXPECT_LE(actor->handled.load(), 4u);
+    system->Stop();
+}
+
+TEST(TimingWheelTests, DelaysBeyondFirstLevelCascadeDown)
+{
+    // With a 100us tick, 60ms spans 600 ticks and starts on the second level of the wheel
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "timer-tests", ox::ActorSystemConfig{.thread_count = 1, .timer_tick = 100us})};
+    const auto actor{system->CreateActor<TimerTargetActor>("target")};
+    Start(actor);
+
+    const auto scheduled_at{std::chrono::steady_clock::now()};
+    system->ScheduleOnce(60ms, ox::ActorRef{actor, system}, ox::MakeMessage<TimerFiredMessage>(3));
+    ASSERT_TRUE(WaitUntil([&] { return actor->handled.load() == 1; }));
+    const auto fired_at{std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{actor->first_at_ns}}};
+    EXPECT_GE(fired_at - scheduled_at, 60ms);
+    EXPECT_LT(fired_at - scheduled_at, 1s);
+    system->Stop();
+}
+
+TEST(TimingWheelTests, ManyOutstandingTimersAreCancelledInPlace)
+{
+    ox::TimingWheel wheel;
+    const ox::ActorRef nobody{ox::ActorId{}, {}};
+
+    std::vector<ox::TimerHandle> handles;
+    handles.reserve(100'000);
+    for (std::size_t i{0}; i < 100'000; ++i)
+    {
+        handles.push_back(wheel.ScheduleOnce(std::chrono::seconds{60 + i % 3600}, nobody, {}));
+    }
+    EXPECT_EQ(wheel.GetTimerCount(), 100'000u);
+
+    for (std::size_t i{0}; i < handles.size(); i += 2)
+    {
+        EXPECT_TRUE(wheel.Cancel(handles[i]));
+    }
+    EXPECT_EQ(wheel.GetTimerCount(), 50'000u);
+
+    // Освобождённые узлы переиспользуются, но старые дескрипторы к ним уже не подходят
+    const auto reused{wheel.ScheduleOnce(1h, nobody, {})};
+    EXPECT_EQ(reused.index, handles[99'998].index);
+    EXPECT_FALSE(wheel.Cancel(handles[99'998]));
+    EXPECT_TRUE(wheel.Cancel(reused));
+
+    wheel.Stop();
+    EXPECT_EQ(wheel.GetTimerCount(), 0u);
+    EXPECT_FALSE(wheel.ScheduleOnce(1ms, nobody, {}));
+}
+
+TEST(TimingWheelTests, FirstTimerAfterIdleFiresOnTime)
+{
+    // Мелкий тик, чтобы простой набрал миллионы пропущенных тиков
+    ox::TimingWheel wheel{10ns};
+    std::atomic<int> fired{0};
+    wheel.ScheduleCallback(1ms, [&] { ++fired; });
+    ASSERT_TRUE(WaitUntil([&] { return fired.load() == 1; }));
+    EXPECT_EQ(wheel.GetTimerCount(), 0u);
+
+    std::this_thread::sleep_for(500ms);
+
+    // Пропущенные за простой тики не проигрываются по одному
+    std::atomic<std::int64_t> fired_at_ns{0};
+    const auto scheduled_at{std::chrono::steady_clock::now()};
+    wheel.ScheduleCallback(5ms, [&] {
+        fired_at_ns = std::chrono::steady_clock::now().time_since_epoch().count();
+        ++fired;
+    });
+    ASSERT_TRUE(WaitUntil([&] { return fired.load() == 2; }));
+    const auto fired_at{std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{fired_at_ns}}};
+    EXPECT_GE(fired_at - scheduled_at, 5ms);
+    EXPECT_LT(fired_at - scheduled_at, 100ms);
+    wheel.Stop();
+}
+
+TEST(TimingWheelTests, SystemTrimsMessagePoolsPeriodically)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "timer-tests", ox::ActorSystemConfig{.thread_count = 1, .pool_trim_interval = 2ms})};
+
+    // Блоки возвращаются в пул при выходе потока, после чего пул держит только пустые куски
+    std::thread worker{[] {
+        std::vector<ox::MPtr<TrimmedPoolMessage>> messages(10'000);
+        for (auto &message : messages)
+        {
+            message = ox::MakeMessage<TrimmedPoolMessage>();
+        }
+    }};
+    worker.join();
+    EXPECT_TRUE(WaitUntil([] { return TrimmedPoolMessage::GetPoolHeldBytes() == 0; }));
+    system->Stop();
+}
+
+} // namespace testing
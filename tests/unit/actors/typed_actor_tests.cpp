@@ -0,0 +1,133 @@
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/ask.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/typed_actor.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+struct AddMessage final : ox::Message<AddMessage>
+{
+    explicit AddMessage(const int value) : value{value}
+    {
+    }
+
+    int value;
+};
+
+struct KeepMessage final : ox::Message<KeepMessage>
+{
+};
+
+struct TotalRequest final : ox::RequestMessage<TotalRequest>
+{
+};
+
+struct TotalReply final : ox::Message<TotalReply>
+{
+    explicit TotalReply(const int total) : total{total}
+    {
+    }
+
+    int total;
+};
+
+struct ForeignMessage final : ox::Message<ForeignMessage>
+{
+};
+
+class AccumulatorActor final : public ox::TypedActor<AccumulatorActor, AddMessage, KeepMessage, TotalRequest>
+{
+  public:
+    using TypedActor::TypedActor;
+
+    auto Handle(const AddMessage &message) -> void
+    {
+        total += message.value;
+    }
+
+    // Сообщение можно сохранить, если обработчик принимает MPtr
+    auto Handle(const ox::MPtr<KeepMessage> &message) -> void
+    {
+        kept.push_back(message);
+    }
+
+    auto Handle(const TotalRequest &request) -> void
+    {
+        request.reply_to.Tell(ox::MakeMessage<TotalReply>(total));
+    }
+
+    int total{0};
+    std::vector<ox::MPtr<KeepMessage>> kept;
+    int unhandled{0};
+
+  protected:
+    auto OnUnhandled(const ox::MPtr<ox::BaseMessage> &message) -> void override
+    {
+        (void)message;
+        ++unhandled;
+    }
+};
+
+using AccumulatorRef = ox::TypedActorRef<AccumulatorActor::ProtocolType>;
+
+template <typename MessageType>
+concept AccumulatorAccepts = requires(AccumulatorRef &ref, const ox::MPtr<MessageType> &message) {
+    ref.Tell(message);
+};
+
+// Сообщение вне протокола не компилируется при отправке через типизированную ссылку
+static_assert(AccumulatorAccepts<AddMessage>);
+static_assert(AccumulatorAccepts<TotalRequest>);
+static_assert(!AccumulatorAccepts<ForeignMessage>);
+static_assert(!AccumulatorAccepts<TotalReply>);
+
+TEST(TypedActorTests, ProtocolMessagesReachTheirHandlers)
+{
+    boost::asio::io_context io_context;
+    const auto actor{ox::MakeSptr<AccumulatorActor>(io_context.get_executor(), "accumulator",
+                                                    ox::ActorIDGenerator::Generate())};
+    AccumulatorRef actor_ref{actor, {}};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+
+    actor_ref.Tell(ox::MakeMessage<AddMessage>(2));
+    actor_ref.Tell(ox::MakeMessage<AddMessage>(40));
+    const auto kept{ox::MakeMessage<KeepMessage>()};
+    EXPECT_TRUE(actor_ref.TryTell(kept));
+    // Нетипизированная ссылка по-прежнему может прислать что угодно
+    actor_ref.GetRef().Tell(ox::MakeMessage<ForeignMessage>());
+    io_context.run();
+
+    EXPECT_EQ(actor->total, 42);
+    ASSERT_EQ(actor->kept.size(), 1u);
+    EXPECT_EQ(actor->kept.front(), kept);
+    EXPECT_EQ(actor->unhandled, 1);
+}
+
+TEST(TypedActorTests, AskGoesThroughTypedRef)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>("typed-actor-tests", ox::ActorSystemConfig{.thread_count = 2})};
+    const auto actor{system->CreateActor<AccumulatorActor>("accumulator")};
+    AccumulatorRef actor_ref{actor, system};
+    actor->Receive(ox::MakeMessage<ox::GoStartActor>());
+
+    actor_ref.Tell(ox::MakeMessage<AddMessage>(7));
+    auto reply{actor_ref.Ask<TotalReply>(ox::MakeMessage<TotalRequest>(), 5s).Get()};
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(reply->total, 7);
+    system->Stop();
+}
+
+} // namespace testing
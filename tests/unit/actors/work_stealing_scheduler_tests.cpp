@@ -0,0 +1,180 @@
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <oxherdcpp/actor/actor.h>
+#include <oxherdcpp/actor/actor_ref.h>
+#include <oxherdcpp/actor/actor_system.h>
+#include <oxherdcpp/actor/events.h>
+#include <oxherdcpp/actor/scheduler/work_stealing_scheduler.h>
+
+namespace testing
+{
+
+namespace ox = oxherdcpp;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+template <typename Predicate> auto WaitFor(Predicate predicate, const std::chrono::milliseconds timeout = 5s) -> bool
+{
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+} // namespace
+
+TEST(WorkStealingSchedulerTests, ExecutorIsUsableAsAnyIoExecutor)
+{
+    ox::WorkStealingScheduler scheduler{2};
+    const boost::asio::any_io_executor executor{scheduler.get_executor()};
+
+    std::atomic<std::size_t> executed{0};
+    for (int i{0}; i < 1000; ++i)
+    {
+        boost::asio::post(executor, [&executed] { executed.fetch_add(1); });
+    }
+    ASSERT_TRUE(WaitFor([&] { return executed.load() == 1000; }));
+    EXPECT_EQ(&boost::asio::query(executor, boost::asio::execution::context), &scheduler);
+}
+
+TEST(WorkStealingSchedulerTests, StopDrainsQueuedWork)
+{
+    std::atomic<std::size_t> executed{0};
+    {
+        ox::WorkStealingScheduler scheduler{3};
+        for (int i{0}; i < 500; ++i)
+        {
+            boost::asio::post(scheduler.get_executor(), [&executed] {
+                std::this_thread::sleep_for(10us);
+                executed.fetch_add(1);
+            });
+        }
+        scheduler.Stop();
+    }
+    EXPECT_EQ(executed.load(), 500u);
+}
+
+TEST(WorkStealingSchedulerTests, SubmitAfterStopDestroysTask)
+{
+    ox::WorkStealingScheduler scheduler{2};
+    scheduler.Stop();
+
+    // Задача, отправленная после остановки, не выполняется, но и не утекает
+    const auto guard{std::make_shared<int>(0)};
+    bool executed{false};
+    boost::asio::post(scheduler.get_executor(), [guard, &executed] { executed = true; });
+    EXPECT_FALSE(executed);
+    EXPECT_EQ(guard.use_count(), 1);
+}
+
+TEST(WorkStealingSchedulerTests, ForkRunsBeforeOlderLocalWork)
+{
+    ox::WorkStealingScheduler scheduler{1};
+    const auto executor{scheduler.get_executor()};
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record{[&](const int value) {
+        std::lock_guard lock{mutex};
+        order.push_back(value);
+    }};
+
+    boost::asio::post(executor, [&] {
+        EXPECT_TRUE(scheduler.RunningInThisThread());
+        // Continuations queue up in FIFO order...
+        boost::asio::defer(executor, [&] { record(1); });
+        boost::asio::defer(executor, [&] { record(2); });
+        // ...while the latest fork takes the LIFO slot and runs next
+        boost::asio::post(executor, [&] { record(3); });
+    });
+    ASSERT_TRUE(WaitFor([&] {
+        std::lock_guard lock{mutex};
+        return order.size() == 3;
+    }));
+    EXPECT_EQ(order, (std::vector<int>{3, 1, 2}));
+    EXPECT_FALSE(scheduler.RunningInThisThread());
+}
+
+TEST(WorkStealingSchedulerTests, IdleWorkerStealsFromBusyWorker)
+{
+    ox::WorkStealingScheduler scheduler{2};
+    const auto executor{scheduler.get_executor()};
+
+    constexpr std::size_t kTasks{64};
+    std::atomic<std::size_t> executed{0};
+    std::atomic<bool> finished{false};
+
+    boost::asio::post(executor, [&] {
+        for (std::size_t i{0}; i < kTasks; ++i)
+        {
+            boost::asio::defer(executor, [&executed] { executed.fetch_add(1); });
+        }
+        // Тут задачи лежат в локальной очереди занятого воркера: выполнить их может только другой воркер
+        finished.store(WaitFor([&] { return executed.load() == kTasks; }));
+    });
+    ASSERT_TRUE(WaitFor([&] { return finished.load(); }));
+    EXPECT_GT(scheduler.GetStealCount(), 0u);
+}
+
+class PingPongActor final : public ox::Actor
+{
+  public:
+    using Actor::Actor;
+
+    struct Ball final : ox::Message<Ball>
+    {
+        explicit Ball(const std::size_t remaining) : remaining{remaining}
+        {
+        }
+        std::size_t remaining;
+    };
+
+    std::optional<ox::ActorRef> partner;
+    std::atomic<bool> done{false};
+
+  protected:
+    void Behaviour(const ox::MPtr<ox::BaseMessage> &message) override
+    {
+        const auto ball{ox::Cast<Ball>(message)};
+        if (ball->remaining == 0)
+        {
+            done.store(true);
+            return;
+        }
+        partner->Tell(ox::MakeMessage<Ball>(ball->remaining - 1));
+    }
+};
+
+TEST(WorkStealingSchedulerTests, ActorSystemRunsActorsOnWorkStealingScheduler)
+{
+    const auto system{ox::MakeSptr<ox::ActorSystem>(
+        "work-stealing-tests", ox::ActorSystemConfig{.thread_count = 2, .scheduler = ox::SchedulerKind::WorkStealing})};
+
+    const auto ping{system->CreateActor<PingPongActor>("ping")};
+    const auto pong{system->CreateActor<PingPongActor>("pong")};
+    ping->partner.emplace(pong, system);
+    pong->partner.emplace(ping, system);
+    ping->Receive(ox::MakeMessage<ox::GoStartActor>());
+    pong->Receive(ox::MakeMessage<ox::GoStartActor>());
+
+    ping->Receive(ox::MakeMessage<PingPongActor::Ball>(10'001));
+    ASSERT_TRUE(WaitFor([&] { return pong->done.load(); }));
+    EXPECT_FALSE(ping->done.load());
+
+    system->Stop();
+}
+
+} // namespace testing